@@ -0,0 +1,280 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: libdac.h                                                           |
+| project:  ZX Spectrum Next - libdac                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for digital sample playback (8-bit DACs fed by zxnDMA)                |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__LIBDAC_H__)
+  #define __LIBDAC_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+/*!
+IO-port of the DACs in "Specdrum" mode (DAC A + D, mono)
+*/
+#define DAC_PORT_SPECDRUM (0xDF)
+
+/*!
+IO-port of the DACs in "Covox" mode (DAC A + D, mono)
+*/
+#define DAC_PORT_COVOX (0xFB)
+
+/*!
+IO-port of the DACs in "GS Covox" mode (DAC B + C, mono)
+*/
+#define DAC_PORT_GS_COVOX (0xB3)
+
+/*!
+Reference clock of the prescaler of the zxnDMA in [Hz]; the sample rate is
+"DAC_CLOCK_DMA / prescaler".
+*/
+#define DAC_CLOCK_DMA (875000)
+
+/*!
+Lowest possible sample rate in [Hz] (prescaler = 255)
+*/
+#define DAC_RATE_MIN ((uint16_t) ((DAC_CLOCK_DMA + 254) / 255))
+
+/*!
+Highest sample rate in [Hz], that is accepted by the driver
+*/
+#define DAC_RATE_MAX (32000)
+
+/*!
+Value of a sample that represents silence (unsigned 8-bit PCM)
+*/
+#define DAC_SILENCE (0x80)
+
+/*!
+MMU slot that is used by default to page in the banks of a stream
+("3" = 0x6000 .. 0x7FFF)
+*/
+#define DAC_DEFAULT_SLOT (3)
+
+#define DAC_STATE_IDLE   (0x00)   /* nothing is played */
+#define DAC_STATE_PLAY   (0x01)   /* sample is played once from memory */
+#define DAC_STATE_LOOP   (0x02)   /* sample is played in a loop from memory */
+#define DAC_STATE_STREAM (0x03)   /* stream is played through double buffer */
+
+#define DAC_PLAY_ONCE (0)         /* dac_play */
+#define DAC_PLAY_LOOP (1)         /* dac_play */
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+/*!
+This structure is used to manage the playback of digital samples. There is
+only one zxnDMA in the system: only one sample/stream can be played at a time.
+*/
+typedef struct _dacstate
+{
+  /*!
+  IO-port of the DAC (i.e. "DAC_PORT_SPECDRUM")
+  */
+  uint8_t uiPort;
+
+  /*!
+  MMU slot ("0" .. "7") that is used to page in the banks of a stream while the
+  double buffer is refilled. Neither code, stack nor the double buffer may be
+  located in this slot (default: "DAC_DEFAULT_SLOT").
+  */
+  uint8_t uiSlot;
+
+  /*!
+  Current state of the playback (i.e. "DAC_STATE_IDLE")
+  */
+  uint8_t uiState;
+
+  /*!
+  In this internal structure are all the variables, that are required to
+  refill the double buffer of a stream. This part is not part of the official
+  API and can be changed in future releases.
+  */
+  struct
+  {
+    /*!
+    Backup of next-reg "PERIPHERAL3" (0x08) at "dac_open"
+    */
+    uint8_t uiPeripheral3;
+
+    /*!
+    Double buffer of a stream (2 * uiHalf bytes)
+    */
+    uint8_t* pBuffer;
+
+    /*!
+    Size of one half of the double buffer
+    */
+    uint16_t uiHalf;
+
+    /*!
+    Index of the half of the double buffer, that is refilled next ("0", "1")
+    */
+    uint8_t uiFill;
+
+    /*!
+    Current 8K-page of the stream
+    */
+    uint8_t uiPage;
+
+    /*!
+    Current offset in the 8K-page of the stream ("0" .. "8191")
+    */
+    uint16_t uiOffset;
+
+    /*!
+    Number of bytes of the stream that are not yet copied to the double buffer
+    */
+    uint32_t uiRemain;
+
+    /*!
+    Number of halves of the double buffer, that are played after the end of
+    the stream has been copied (end of playback if "0" is reached)
+    */
+    uint8_t uiDrain;
+  } tPriv;
+} dacstate_t;
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+/*!
+This function opens access to the DACs and enables them (next-reg 0x08, BIT3).
+The settings of the sound generators (Turbosound) are not touched, so samples
+can be played while a "psgstate_t" is open.
+@param pState Pointer to device structure
+@param uiPort IO-port of the DAC (i.e. "DAC_PORT_SPECDRUM")
+@return EOK = no error
+*/
+uint8_t dac_open(dacstate_t* pState, uint8_t uiPort);
+
+/*!
+Calculates the prescaler of the zxnDMA for a given sample rate.
+@param uiRate Sample rate in [Hz] ("DAC_RATE_MIN" .. "DAC_RATE_MAX")
+@return Prescaler ("1" .. "255"); "0" = sample rate out of range
+*/
+uint8_t dac_calc_prescaler(uint16_t uiRate);
+
+/*!
+Play a sample, that is visible in the address space of the CPU. The transfer
+is done by the zxnDMA in burst mode, timed by the prescaler: there is no load
+on the CPU.
+@code
+  dacstate_t tDac;
+  dac_open(&tDac, DAC_PORT_SPECDRUM);
+  dac_play(&tDac, acSample, sizeof(acSample), 11025, DAC_PLAY_ONCE);
+@endcode
+@param pState Pointer to device structure
+@param pData Unsigned 8-bit PCM data
+@param uiLength Length of the sample in bytes
+@param uiRate Sample rate in [Hz]
+@param uiMode "DAC_PLAY_ONCE" or "DAC_PLAY_LOOP"
+@return EOK = no error; ERANGE = sample rate out of range
+*/
+uint8_t dac_play(dacstate_t* pState, const uint8_t* pData, uint16_t uiLength, uint16_t uiRate, uint8_t uiMode);
+
+/*!
+Play a stream of samples that is located in consecutive 8K-pages (i.e. loaded
+from a file into banks). The zxnDMA plays a double buffer in a loop; the half,
+that has been played, is refilled by "dac_update".
+@code
+  static uint8_t acBuffer[2 * 512];
+  dac_stream(&tDac, 40, 0, 120000, 15625, acBuffer, sizeof(acBuffer));
+  while (DAC_STATE_IDLE != tDac.uiState)
+  {
+    dac_update(&tDac);
+    ...
+  }
+@endcode
+@param pState Pointer to device structure
+@param uiPage First 8K-page of the stream
+@param uiOffset Offset of the first sample in the first page ("0" .. "8191")
+@param uiLength Length of the stream in bytes
+@param uiRate Sample rate in [Hz]
+@param pBuffer Double buffer (must not be located in MMU slot "uiSlot")
+@param uiSize Size of the double buffer in bytes
+@return EOK = no error; ERANGE = sample rate out of range
+@remark
+"dac_update" has to be called at least once while one half of the buffer is
+played: "uiSize / 2 >= uiRate / 50" to call it once a frame.
+*/
+uint8_t dac_stream(dacstate_t* pState, uint8_t uiPage, uint16_t uiOffset, uint32_t uiLength, uint16_t uiRate, uint8_t* pBuffer, uint16_t uiSize);
+
+/*!
+Refill the double buffer of a stream and detect the end of the playback. This
+function has to be called periodically (i.e. once a frame).
+@param pState Pointer to device structure
+@return EOK = no error
+*/
+uint8_t dac_update(dacstate_t* pState) __z88dk_fastcall;
+
+/*!
+Stop the current playback.
+@param pState Pointer to device structure
+@return EOK = no error
+*/
+uint8_t dac_stop(dacstate_t* pState) __z88dk_fastcall;
+
+/*!
+This function stops the playback and restores the state of the DACs.
+@param pState Pointer to device structure
+@return EOK = no error
+*/
+uint8_t dac_close(dacstate_t* pState);
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __LIBDAC_H__ */
@@ -134,6 +134,66 @@ Value to set mouse sensitivity to HIGH
 */
 #define MOUSE_SENSITIVITY_HIGH (0x03)
 
+/*!
+Mouse button: right (BIT0 of "uiBtn")
+*/
+#define MOUSE_BTN_RIGHT (0x01)
+
+/*!
+Mouse button: left (BIT1 of "uiBtn")
+*/
+#define MOUSE_BTN_LEFT (0x02)
+
+/*!
+Mouse button: middle (BIT2 of "uiBtn")
+*/
+#define MOUSE_BTN_MIDDLE (0x04)
+
+/*!
+Size of the event queue of a mouse (power of 2)
+*/
+#define uiMAX_MOUSEEVENTS (8)
+
+/*!
+Type of a mouse event: button was pressed ("uiData" = button)
+*/
+#define MOUSE_EVENT_DOWN (0x01)
+
+/*!
+Type of a mouse event: button was released ("uiData" = button)
+*/
+#define MOUSE_EVENT_UP (0x00)
+
+/*!
+Type of a mouse event: scroll wheel was moved ("uiData" = signed steps)
+*/
+#define MOUSE_EVENT_WHEEL (0x02)
+
+/*!
+Number of entries of an acceleration curve (see "mouse_set_curve")
+*/
+#define MOUSE_CURVE_SIZE (16)
+
+/*!
+Layer of the mouse cursor: 256 x 192 pixels (ULA, Layer 2 256 x 192)
+*/
+#define MOUSE_LAYER_256x192 (0x00)
+
+/*!
+Layer of the mouse cursor: 320 x 256 pixels (Layer 2 320 x 256)
+*/
+#define MOUSE_LAYER_320x256 (0x01)
+
+/*!
+Layer of the mouse cursor: 640 x 256 pixels (Layer 2 640 x 256)
+*/
+#define MOUSE_LAYER_640x256 (0x02)
+
+/*!
+Size of the pattern of a mouse cursor (16 x 16 pixels, 8 bit per pixel)
+*/
+#define MOUSE_CURSOR_PATTERN_SIZE (256)
+
 /*!
 Number of next-reg "PERIPHERAL5"
 */
@@ -155,6 +215,13 @@ This macro delivers the version number of the library as a string literal
 /*============================================================================*/
 /*                               Variables                                    */
 /*============================================================================*/
+/*!
+Acceleration curves for "mouse_set_curve()": linear (gain 1.0), mild (1.0 ..
+2.0) and fast (precise at low speed, up to 3.0 at high speed)
+*/
+extern const uint8_t g_acMouseCurveLinear[MOUSE_CURVE_SIZE];
+extern const uint8_t g_acMouseCurveMild[MOUSE_CURVE_SIZE];
+extern const uint8_t g_acMouseCurveFast[MOUSE_CURVE_SIZE];
 
 /*============================================================================*/
 /*                               Structures                                   */
@@ -207,6 +274,30 @@ typedef struct _joystickstate
   uint8_t uiScratch;
 } joystickstate_t;
 
+/*!
+Event of a mouse: button pressed/released or scroll wheel moved (see
+"mouse_get_event")
+*/
+typedef struct _mouseevent
+{
+  /*!
+  Type of the event ("MOUSE_EVENT_DOWN", "MOUSE_EVENT_UP", "MOUSE_EVENT_WHEEL")
+  */
+  uint8_t uiType;
+
+  /*!
+  Button of the event (i.e. "MOUSE_BTN_LEFT") or steps of the scroll wheel
+  ("int8_t")
+  */
+  uint8_t uiData;
+
+  /*!
+  Timestamp of the event in frames (lower 16 bits of the frame counter; in
+  background mode: number of calls of "mouse_isr()")
+  */
+  uint16_t uiFrame;
+} mouseevent_t;
+
 /*!
 This structure is used to manage and read the state of a mouse/trackball
 Current cursor position (x = 0, y = 0: screen left bottom). These coordinates
@@ -273,9 +364,101 @@ typedef struct _mousestate
     Internal buffer for calculations, ...
     */
     uint8_t uiScratch;
+
+    /*!
+    Movement, that is not yet added to "iX"/"iY"
+    */
+    int16_t iAccX;
+    int16_t iAccY;
+
+    /*!
+    Last sampled state of the buttons and the scroll wheel
+    */
+    uint8_t uiBtn;
+    uint8_t uiWhl;
+
+    /*!
+    Number of samples by "mouse_isr()" (timestamp in background mode)
+    */
+    uint16_t uiTicks;
+
+    /*!
+    Ring buffer of button and wheel events
+    */
+    mouseevent_t tEvent[uiMAX_MOUSEEVENTS];
+
+    /*!
+    Write/read index of the ring buffer
+    */
+    uint8_t uiHead;
+    uint8_t uiTail;
+
+    /*!
+    Number of events, that were lost because the queue was full
+    */
+    uint8_t uiLost;
+
+    /*!
+    Acceleration curve ("NULL" = raw movement)
+    */
+    const uint8_t* pCurve;
+
+    /*!
+    Fractional part of the position (8.8 fixed-point)
+    */
+    uint8_t uiFracX;
+    uint8_t uiFracY;
+
+    /*!
+    Rectangle, the position is clamped to (if "uiClamp" is not "0")
+    */
+    int16_t iMinX;
+    int16_t iMinY;
+    int16_t iMaxX;
+    int16_t iMaxY;
+    uint8_t uiClamp;
   } tPriv;
 } mousestate_t;
 
+/*!
+This structure is used to manage a mouse cursor, that is displayed by a hardware
+sprite
+*/
+typedef struct _mousecursor
+{
+  /*!
+  Number of the hardware sprite (0 .. 127)
+  */
+  uint8_t uiSprite;
+
+  /*!
+  Pattern slot of the cursor (0 .. 63)
+  */
+  uint8_t uiPattern;
+
+  /*!
+  Hotspot inside of the pattern (0 .. 15)
+  */
+  uint8_t uiHotX;
+  uint8_t uiHotY;
+
+  /*!
+  Layer, the position of the mouse refers to (i.e. "MOUSE_LAYER_256x192")
+  */
+  uint8_t uiLayer;
+
+  /*!
+  Internal use only
+  */
+  struct
+  {
+    /*!
+    Attributes 0 .. 4 of the sprite, as they were written to the hardware
+    */
+    uint8_t uiAttr[5];
+  } tPriv;
+} mousecursor_t;
+
 /*============================================================================*/
 /*                               Prototypes                                   */
 /*============================================================================*/
@@ -346,6 +529,40 @@ Read the current setting of mouse sensitivity
 */
 uint8_t mouse_get_sensitivity(mousestate_t* pState) __z88dk_fastcall;
 
+/*!
+Set the acceleration curve of the software pointer ballistics. The curve has
+"MOUSE_CURVE_SIZE" gains (4.4 fixed-point: 0x10 = 1.0, 0x20 = 2.0, ...); the
+gain is selected by the speed of the mouse (counts per sample; 15 and more use
+the last entry). The movement is accumulated with 1/256 pixel, so slow
+movements with a gain below 1.0 are not lost.
+@code
+  static const uint8_t g_acCurve[MOUSE_CURVE_SIZE] =
+  {
+    0x10, 0x0C, 0x0C, 0x10, 0x14, 0x18, 0x1C, 0x20,
+    0x24, 0x28, 0x2C, 0x30, 0x30, 0x30, 0x30, 0x30
+  };
+  mouse_set_curve(&tMouse, g_acCurve);
+@endcode
+@param pState Pointer to device-structure
+@param pCurve Acceleration curve (i.e. "g_acMouseCurveMild"); "NULL" = off
+@return EOK = no error
+@remark
+The curve works on the movement of a single sample: in background mode (see
+"mouse_set_background") this is the movement of one frame.
+*/
+uint8_t mouse_set_curve(mousestate_t* pState, const uint8_t* pCurve);
+
+/*!
+Clamp the position of the mouse to a rectangle (i.e. the screen).
+@param pState Pointer to device-structure
+@param iMinX Left border
+@param iMinY Bottom border
+@param iMaxX Right border; "iMaxX < iMinX" = no clamping
+@param iMaxY Top border
+@return EOK = no error
+*/
+uint8_t mouse_set_clamp(mousestate_t* pState, int16_t iMinX, int16_t iMinY, int16_t iMaxX, int16_t iMaxY);
+
 /*!
 The current position of the mouse can be reset with this function.
 @param pState Pointer to device-structure
@@ -364,6 +581,116 @@ structure.
 */
 uint8_t mouse_read(mousestate_t* pState) __z88dk_fastcall;
 
+/*!
+Read the next button or wheel event of a mouse. Events are queued by
+"mouse_read()" or - in background mode - by "mouse_isr()".
+@code
+  mouseevent_t tEvent;
+  mouse_read(&tMouse);
+  while (mouse_get_event(&tMouse, &tEvent))
+  {
+    if ((MOUSE_EVENT_DOWN == tEvent.uiType) && (MOUSE_BTN_LEFT == tEvent.uiData))
+    {
+      ...
+    }
+  }
+@endcode
+@param pState Pointer to device-structure
+@param pEvent Buffer for the event
+@return "true" = event read; "false" = queue is empty
+*/
+bool mouse_get_event(mousestate_t* pState, mouseevent_t* pEvent);
+
+/*!
+Enable or disable sampling of a mouse in the background: the mouse is sampled
+by "mouse_isr()", that has to be called from an interrupt handler of the
+application (once a frame). The movement is accumulated every frame, so the
+8-bit counters of the mouse can't wrap, even if the application does not call
+"mouse_read()" for a long time; no click is lost. "mouse_read()" just adds the
+accumulated movement to the position. Only one mouse can be sampled in the
+background.
+@code
+  IM2_DEFINE_ISR(isr_frame)
+  {
+    mouse_isr();
+  }
+  ...
+  mouse_open(&tMouse, 0);
+  mouse_set_background(&tMouse, true);
+@endcode
+@param pState Pointer to device-structure
+@param bEnable "true" = sample in the background; "false" = in "mouse_read()"
+@return EOK = no error
+*/
+uint8_t mouse_set_background(mousestate_t* pState, bool bEnable);
+
+/*!
+Sample the mouse, that was selected by "mouse_set_background()". This function
+has to be called from the interrupt handler of the application.
+*/
+void mouse_isr(void);
+
+/*!
+Create a mouse cursor: the pattern is uploaded once into a pattern slot and the
+sprites are enabled (next-reg 0x15, BIT0). The cursor is hidden until the first
+call of "mouse_cursor_update()".
+@code
+  mouse_open(&tMouse, 0);
+  mouse_set_clamp(&tMouse, 0, 0, 255, 191);
+  mouse_cursor_open(&tCursor, 127, 63, g_acArrow);
+
+  while (...)
+  {
+    mouse_read(&tMouse);
+    mouse_cursor_update(&tCursor, &tMouse);  // once a frame
+  }
+@endcode
+@param pCursor Pointer to cursor-structure
+@param uiSprite Number of the hardware sprite (0 .. 127)
+@param uiPattern Pattern slot (0 .. 63)
+@param pPattern Pattern ("MOUSE_CURSOR_PATTERN_SIZE" bytes; transparent colour:
+                next-reg 0x4B, default 0xE3)
+@return EOK = no error
+*/
+uint8_t mouse_cursor_open(mousecursor_t* pCursor, uint8_t uiSprite, uint8_t uiPattern, const uint8_t* pPattern);
+
+/*!
+Set the hotspot of a mouse cursor: the pixel of the pattern, that points to the
+position of the mouse (i.e. "0, 0" for an arrow, "7, 7" for a cross hair).
+@param pCursor Pointer to cursor-structure
+@param uiHotX X-position in the pattern (0 .. 15)
+@param uiHotY Y-position in the pattern (0 .. 15, from top)
+@return EOK = no error
+*/
+uint8_t mouse_cursor_set_hotspot(mousecursor_t* pCursor, uint8_t uiHotX, uint8_t uiHotY);
+
+/*!
+Set the resolution of the layer, the position of the mouse refers to
+(x = 0, y = 0: bottom left corner of the layer). The position is clipped to
+the layer.
+@param pCursor Pointer to cursor-structure
+@param uiLayer Layer (i.e. "MOUSE_LAYER_320x256")
+@return EOK = no error
+*/
+uint8_t mouse_cursor_set_layer(mousecursor_t* pCursor, uint8_t uiLayer);
+
+/*!
+Move the mouse cursor to the current position of a mouse and show it. Only the
+attributes of the sprite, that have changed, are written (no write at all, if
+the mouse was not moved).
+@param pCursor Pointer to cursor-structure
+@param pMouse Mouse (the position is read from "iX", "iY")
+@return EOK = no error
+*/
+uint8_t mouse_cursor_update(mousecursor_t* pCursor, const mousestate_t* pMouse);
+
+/*!
+Hide a mouse cursor (it's shown again by "mouse_cursor_update()").
+@param pCursor Pointer to cursor-structure
+@return EOK = no error
+*/
+uint8_t mouse_cursor_hide(mousecursor_t* pCursor) __z88dk_fastcall;
+
 /*!
 This function closes access to a mouse/trackball.
 @param pState Pointer to device-structure
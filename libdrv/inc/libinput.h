@@ -0,0 +1,433 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: libinput.h                                                         |
+| project:  ZX Spectrum Next - libinput                                        |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Unified input of keyboard, mouse and joysticks on ZX Spectrum Next           |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__LIBINPUT_H__)
+  #define __LIBINPUT_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include "libdrv.h"
+#include "libkbd.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+/*!
+Device of "input_poll()": keyboard
+*/
+#define INPUT_DEV_KBD (0x01)
+
+/*!
+Device of "input_poll()": mouse
+*/
+#define INPUT_DEV_MOUSE (0x02)
+
+/*!
+Device of "input_poll()": left joystick/gamepad
+*/
+#define INPUT_DEV_JOY0 (0x04)
+
+/*!
+Device of "input_poll()": right joystick/gamepad
+*/
+#define INPUT_DEV_JOY1 (0x08)
+
+/*!
+Number of (virtual) joysticks of an input frame
+*/
+#define uiMAX_INPUTPADS (2)
+
+/*!
+Number of entries of the default key mappings ("g_tInputMapQAOP", ...)
+*/
+#define INPUT_MAP_DEFAULT_SIZE (5)
+
+/*!
+Mode of an input log: closed/finished
+*/
+#define INPUT_LOG_IDLE (0x00)
+
+/*!
+Mode of an input log: the input of "input_poll()" is recorded
+*/
+#define INPUT_LOG_RECORD (0x01)
+
+/*!
+Mode of an input log: "input_poll()" replays the log instead of reading the
+devices
+*/
+#define INPUT_LOG_REPLAY (0x02)
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+/*!
+Mapping of a key to the directions/buttons of a (virtual) joystick
+*/
+typedef struct _inputmap
+{
+  /*!
+  Code of the key (i.e. "KBD_SCANCODE_Q")
+  */
+  uint16_t uiScanCode;
+
+  /*!
+  Joystick, that is controlled by the key (0, 1)
+  */
+  uint8_t uiPad;
+
+  /*!
+  Directions (i.e. "JOYSTICK_DIR_UP") and buttons (i.e. "JOYSTICK_BTN_B"), that
+  are set while the key is pressed
+  */
+  uint8_t uiDir;
+  uint8_t uiBtn;
+} inputmap_t;
+
+/*!
+Default key mappings to joystick 0: Q/A/O/P + SPACE and cursor keys (5, 6, 7,
+8) + 0
+*/
+extern const inputmap_t g_tInputMapQAOP[INPUT_MAP_DEFAULT_SIZE];
+extern const inputmap_t g_tInputMapCursor[INPUT_MAP_DEFAULT_SIZE];
+
+/*!
+Raw input of one frame, as it is recorded in an input log
+*/
+typedef struct _inputsample
+{
+  /*!
+  Rows of the keyboard
+  */
+  kbdrows_t tKeys;
+
+  /*!
+  Joysticks (without mapped keys): direction and buttons of pad 0 and 1
+  */
+  uint8_t uiJoy[2 * uiMAX_INPUTPADS];
+
+  /*!
+  Mouse: position, buttons and scroll wheel
+  */
+  int16_t iMouseX;
+  int16_t iMouseY;
+  uint8_t uiMouseBtn;
+  uint8_t uiMouseWhl;
+} inputsample_t;
+
+/*!
+Input log: recording or replay of the input of "input_poll()". Each record of
+the log holds the number of frames with an unchanged input (run length), a mask
+of the changed groups (keyboard, joysticks, mouse position, mouse buttons) and
+the changed groups only; a run length of "0" ends the log.
+*/
+typedef struct _inputlog
+{
+  /*!
+  Mode of the log (i.e. "INPUT_LOG_RECORD")
+  */
+  uint8_t uiMode;
+
+  /*!
+  Buffer: the whole log (memory) or cache of the file
+  */
+  uint8_t* pBuffer;
+  uint16_t uiSize;
+
+  /*!
+  Position in the buffer; after the recording of a memory log: size of the log
+  */
+  uint16_t uiPos;
+
+  /*!
+  Handle of the file; "INV_FILE_HND" = memory log
+  */
+  uint8_t hFile;
+
+  /*!
+  Number of recorded/replayed frames
+  */
+  uint32_t uiFrames;
+
+  /*!
+  Internal use only
+  */
+  struct
+  {
+    /*!
+    Number of valid bytes in the buffer (replay)
+    */
+    uint16_t uiLength;
+
+    /*!
+    Frames of the current record
+    */
+    uint8_t uiRun;
+
+    /*!
+    Input of the current record and of the previous record
+    */
+    inputsample_t tSample;
+    inputsample_t tPrev;
+  } tPriv;
+} inputlog_t;
+
+/*!
+State of all input devices of one frame (fixed layout). The "...Down" fields
+contain the bits, that were set since the previous frame, the "...Up" fields
+the bits, that were cleared.
+*/
+typedef struct _inputframe
+{
+  /*!
+  Timestamp in frames (lower 16 bits of the frame counter)
+  */
+  uint16_t uiFrame;
+
+  /*!
+  Joysticks/gamepads incl. the mapped keys (see "JOYSTICK_DIR_...",
+  "JOYSTICK_BTN_...")
+  */
+  uint8_t uiDir[uiMAX_INPUTPADS];
+  uint8_t uiBtn[uiMAX_INPUTPADS];
+  uint8_t uiDirDown[uiMAX_INPUTPADS];
+  uint8_t uiBtnDown[uiMAX_INPUTPADS];
+  uint8_t uiDirUp[uiMAX_INPUTPADS];
+  uint8_t uiBtnUp[uiMAX_INPUTPADS];
+
+  /*!
+  Mouse: position, movement since the previous frame, buttons (see
+  "MOUSE_BTN_...") and scroll wheel
+  */
+  int16_t iMouseX;
+  int16_t iMouseY;
+  int16_t iMouseDX;
+  int16_t iMouseDY;
+  uint8_t uiMouseBtn;
+  uint8_t uiMouseBtnDown;
+  uint8_t uiMouseBtnUp;
+  uint8_t uiMouseWhl;
+
+  /*!
+  Keyboard: pressed keys and keys, that were pressed since the previous frame
+  (see "kbd_match")
+  */
+  kbdrows_t tKeys;
+  kbdrows_t tKeysDown;
+} inputframe_t;
+
+/*!
+Configuration and state of "input_poll()"
+*/
+typedef struct _inputstate
+{
+  /*!
+  Polled devices (i.e. "INPUT_DEV_KBD | INPUT_DEV_JOY0")
+  */
+  uint8_t uiDevices;
+
+  /*!
+  Keyboard and mouse (opened by the application)
+  */
+  kbdstate_t* pKbd;
+  mousestate_t* pMouse;
+
+  /*!
+  Mapping of keys to the joysticks
+  */
+  const inputmap_t* pMap;
+  uint8_t uiMapSize;
+
+  /*!
+  Joysticks, that are updated by "input_poll()" (optional)
+  */
+  joystickstate_t* pJoy[uiMAX_INPUTPADS];
+
+  /*!
+  Input log (optional)
+  */
+  inputlog_t* pLog;
+
+  /*!
+  Internal use only: state of the previous frame
+  */
+  struct
+  {
+    uint8_t uiDir[uiMAX_INPUTPADS];
+    uint8_t uiBtn[uiMAX_INPUTPADS];
+    uint8_t uiMouseBtn;
+    int16_t iMouseX;
+    int16_t iMouseY;
+    kbdrows_t tKeys;
+  } tPriv;
+} inputstate_t;
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+/*!
+Configure the devices of "input_poll()". Keyboard and mouse have to be opened
+by the application; the joysticks are read directly from the hardware.
+@param pState Pointer to input-structure
+@param uiDevices Devices to poll (i.e. "INPUT_DEV_KBD | INPUT_DEV_JOY0")
+@param pKbd Keyboard ("NULL" if "INPUT_DEV_KBD" is not set)
+@param pMouse Mouse ("NULL" if "INPUT_DEV_MOUSE" is not set)
+@return EOK = no error
+*/
+uint8_t input_open(inputstate_t* pState, uint8_t uiDevices, kbdstate_t* pKbd, mousestate_t* pMouse);
+
+/*!
+Set the mapping of keys to the directions/buttons of the joysticks: a mapped
+key is reported like the joystick itself, even if no joystick is polled.
+@code
+  input_set_map(&tInput, g_tInputMapQAOP, INPUT_MAP_DEFAULT_SIZE);
+@endcode
+@param pState Pointer to input-structure
+@param pMap Table of mappings ("NULL" = no mapping)
+@param uiSize Number of mappings in the table
+@return EOK = no error
+*/
+uint8_t input_set_map(inputstate_t* pState, const inputmap_t* pMap, uint8_t uiSize);
+
+/*!
+Read all configured devices in a single pass (next-reg 0xB2 of both gamepads is
+read once) and fill an input frame. Call this function once a frame instead of
+"kbd_read()", "mouse_read()" and "joystick_read()"; the event queues of keyboard
+and mouse are fed as usual.
+@code
+  inputframe_t tFrame;
+  input_poll(&tInput, &tFrame);
+  if (tFrame.uiBtnDown[0] & JOYSTICK_BTN_B)
+  {
+    fire();
+  }
+@endcode
+@param pState Pointer to input-structure
+@param pFrame Buffer for the input frame
+@return EOK = no error
+*/
+uint8_t input_poll(inputstate_t* pState, inputframe_t* pFrame);
+
+/*!
+Let "input_poll()" update the state of a joystick (i.e. for code, that reads
+"joystickstate_t"; especially during a replay).
+@param pState Pointer to input-structure
+@param uiIndex Index of the joystick (0, 1)
+@param pJoy Joystick ("NULL" = none)
+@return EOK = no error
+*/
+uint8_t input_set_joystick(inputstate_t* pState, uint8_t uiIndex, joystickstate_t* pJoy);
+
+/*!
+Open an input log for recording or replay. A memory log is held completely in
+the buffer; for a file (esxDOS) the buffer is used as cache.
+@code
+  // Record into memory ...
+  input_log_open(&tLog, INPUT_LOG_RECORD, acLog, sizeof(acLog), 0);
+  input_set_log(&tInput, &tLog);
+  ... input_poll(&tInput, &tFrame) ...
+  input_log_close(&tLog);
+
+  // ... and replay the same session
+  input_log_open(&tLog, INPUT_LOG_REPLAY, acLog, tLog.uiPos, 0);
+  input_set_log(&tInput, &tLog);
+  while (INPUT_LOG_REPLAY == tLog.uiMode)
+  {
+    input_poll(&tInput, &tFrame);
+    ...
+  }
+@endcode
+@param pLog Pointer to log-structure
+@param uiMode "INPUT_LOG_RECORD" or "INPUT_LOG_REPLAY"
+@param pBuffer Buffer for the log/cache
+@param uiSize Size of the buffer; replay of a memory log: size of the log
+@param acFile Name of the file; "NULL" = memory log
+@return EOK = no error
+*/
+uint8_t input_log_open(inputlog_t* pLog, uint8_t uiMode, uint8_t* pBuffer, uint16_t uiSize, const char_t* acFile);
+
+/*!
+Close an input log: a recording is terminated (end of log) and written to the
+file.
+@param pLog Pointer to log-structure
+@return EOK = no error; ERANGE = memory log is full; EBADF = file could not be
+        written
+*/
+uint8_t input_log_close(inputlog_t* pLog) __z88dk_fastcall;
+
+/*!
+Record the input of "input_poll()" into a log or replay a log: while a log is
+replayed, the devices are not read. Keyboard (incl. the key events), mouse
+(incl. the button events) and the joysticks of "input_set_joystick()" are fed
+from the log. When the end of the log is reached, the mode of the log changes
+to "INPUT_LOG_IDLE" and the devices are read again.
+@param pState Pointer to input-structure
+@param pLog Input log ("NULL" = none)
+@return EOK = no error
+@remark
+Background scanning of keyboard and mouse should be disabled during a replay.
+*/
+uint8_t input_set_log(inputstate_t* pState, inputlog_t* pLog);
+
+/*!
+End "input_poll()" of a configuration. Keyboard and mouse are not closed.
+@param pState Pointer to input-structure
+@return EOK = no error
+*/
+uint8_t input_close(inputstate_t* pState) __z88dk_fastcall;
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __LIBINPUT_H__ */
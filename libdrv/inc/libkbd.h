@@ -39,6 +39,8 @@
 /*============================================================================*/
 /*                               Includes                                     */
 /*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
 
 /*============================================================================*/
 /*                               Macros                                       */
@@ -47,6 +49,60 @@
 /*!
 */
 #define uiMAX_KBDROWS (8)
+
+/*!
+Size of the event queue of a keyboard (has to be a power of 2)
+*/
+#define uiMAX_KBDEVENTS (16)
+
+/*!
+Type of a key event: key was pressed
+*/
+#define KBD_EVENT_DOWN (0x01)
+
+/*!
+Type of a key event: key was released
+*/
+#define KBD_EVENT_UP (0x00)
+
+/*!
+Number of keys of the keyboard matrix (8 rows x 5 keys)
+*/
+#define uiMAX_KBDKEYS (uiMAX_KBDROWS * 5)
+
+/*!
+Size of a keymap (see "kbd_set_keymap"): 3 layers (unshifted, CAPS SHIFT,
+SYMBOL SHIFT) of "uiMAX_KBDKEYS" characters; index of a key = row * 5 + bit.
+*/
+#define uiMAX_KBDKEYMAP (3 * uiMAX_KBDKEYS)
+
+/*!
+Default delay (frames) until a held key is repeated (as in the ROM)
+*/
+#define KBD_REPEAT_DELAY (35)
+
+/*!
+Default period (frames) of the repetition of a held key (as in the ROM)
+*/
+#define KBD_REPEAT_RATE (5)
+
+/*!
+Control codes delivered by "kbd_get_char" (codes of the ZX Spectrum ROM)
+*/
+#define KBD_KEY_TRUEVIDEO (0x04)
+#define KBD_KEY_INVVIDEO  (0x05)
+#define KBD_KEY_CAPSLOCK  (0x06)
+#define KBD_KEY_EDIT      (0x07)
+#define KBD_KEY_LEFT      (0x08)
+#define KBD_KEY_RIGHT     (0x09)
+#define KBD_KEY_DOWN      (0x0A)
+#define KBD_KEY_UP        (0x0B)
+#define KBD_KEY_DELETE    (0x0C)
+#define KBD_KEY_ENTER     (0x0D)
+#define KBD_KEY_EXTEND    (0x0E)
+#define KBD_KEY_GRAPH     (0x0F)
+#define KBD_KEY_BREAK     (0x1B)  /* no ROM code; CAPS SHIFT + SPACE */
+
 /*!
 This enumeration describes all the key of the keyboard of ZX SPectrum (Next).
 Each key has his own individual code, that can be used, i.e. to check if a
@@ -169,6 +225,37 @@ enum
 #define KBD_SCANCODE_B    (0x0710)
 #endif
 
+/*!
+Mask of a key in a row of the keyboard matrix ("0" if the key is in another
+row); used by "KBD_KEYSET".
+*/
+#define KBD_KEYSET_ROW(row, code) \
+  ((uint8_t) ((((code) >> 8) == (row)) ? ((code) & 0xFF) : 0))
+
+#define KBD_KEYSET_ROWS(row, a, b, c, d, e, f, g, h, ...) \
+  (KBD_KEYSET_ROW(row, a) | KBD_KEYSET_ROW(row, b) | \
+   KBD_KEYSET_ROW(row, c) | KBD_KEYSET_ROW(row, d) | \
+   KBD_KEYSET_ROW(row, e) | KBD_KEYSET_ROW(row, f) | \
+   KBD_KEYSET_ROW(row, g) | KBD_KEYSET_ROW(row, h))
+
+/*!
+Initializer of a key set ("kbdset_t") of up to 8 scancodes; the row masks are
+computed by the compiler.
+@code
+  static const kbdset_t g_tMove = KBD_KEYSET(KBD_SCANCODE_Q, KBD_SCANCODE_A,
+                                             KBD_SCANCODE_O, KBD_SCANCODE_P);
+@endcode
+*/
+#define KBD_KEYSET(...) \
+  {{ KBD_KEYSET_ROWS(0, __VA_ARGS__, 0, 0, 0, 0, 0, 0, 0, 0), \
+     KBD_KEYSET_ROWS(1, __VA_ARGS__, 0, 0, 0, 0, 0, 0, 0, 0), \
+     KBD_KEYSET_ROWS(2, __VA_ARGS__, 0, 0, 0, 0, 0, 0, 0, 0), \
+     KBD_KEYSET_ROWS(3, __VA_ARGS__, 0, 0, 0, 0, 0, 0, 0, 0), \
+     KBD_KEYSET_ROWS(4, __VA_ARGS__, 0, 0, 0, 0, 0, 0, 0, 0), \
+     KBD_KEYSET_ROWS(5, __VA_ARGS__, 0, 0, 0, 0, 0, 0, 0, 0), \
+     KBD_KEYSET_ROWS(6, __VA_ARGS__, 0, 0, 0, 0, 0, 0, 0, 0), \
+     KBD_KEYSET_ROWS(7, __VA_ARGS__, 0, 0, 0, 0, 0, 0, 0, 0) }}
+
 #if defined(__SDCC)
   #define _KBD_FASTCALL __z88dk_fastcall
 #else
@@ -200,6 +287,33 @@ typedef union _kbdrows
   uint32_t uiRaw32[uiMAX_KBDROWS / sizeof(uint32_t)];
 } kbdrows_t;
 
+/*!
+Set of keys: one mask per row of the keyboard matrix (see "KBD_KEYSET")
+*/
+typedef kbdrows_t kbdset_t;
+
+/*!
+Event of a key, that was pressed or released (see "kbd_get_event")
+*/
+typedef struct _kbdevent
+{
+  /*!
+  Code of the key (i.e. "KBD_SCANCODE_A")
+  */
+  uint16_t uiScanCode;
+
+  /*!
+  Type of the event ("KBD_EVENT_DOWN", "KBD_EVENT_UP")
+  */
+  uint8_t uiType;
+
+  /*!
+  Timestamp of the event in frames (lower 16 bits of the frame counter; in
+  background mode: number of calls of "kbd_isr()")
+  */
+  uint16_t uiFrame;
+} kbdevent_t;
+
 /*!
 Device structure for a keyboard.
 */
@@ -242,6 +356,67 @@ typedef struct _kbdstate
     Raw keyboard state of the last reading. Required to detect changes ... 
     */
     kbdrows_t tRows;
+
+    /*!
+    Ring buffer of key events
+    */
+    kbdevent_t tEvent[uiMAX_KBDEVENTS];
+
+    /*!
+    Index of the next event to write into the ring buffer
+    */
+    uint8_t uiHead;
+
+    /*!
+    Index of the next event to read from the ring buffer
+    */
+    uint8_t uiTail;
+
+    /*!
+    Number of events, that were lost because the ring buffer was full
+    */
+    uint8_t uiLost;
+
+    /*!
+    Number of scans by "kbd_isr()" (timestamp in background mode)
+    */
+    uint16_t uiTicks;
+
+    /*!
+    Keymap used by "kbd_get_char()" ("uiMAX_KBDKEYMAP" characters)
+    */
+    const uint8_t* pKeymap;
+
+    /*!
+    Delay and period of the autorepeat in frames ("0" = no autorepeat)
+    */
+    uint8_t uiRepeatDelay;
+    uint8_t uiRepeatRate;
+
+    /*!
+    State of the modifiers (CAPS SHIFT, SYMBOL SHIFT, CAPS LOCK, extended keys)
+    */
+    uint8_t uiFlags;
+
+    /*!
+    Character, that is repeated while its key is held ("0" = none)
+    */
+    uint8_t uiRepeatChar;
+
+    /*!
+    Scancode of the key, that is repeated
+    */
+    uint16_t uiRepeatCode;
+
+    /*!
+    Timestamp of the next repetition
+    */
+    uint16_t uiRepeatNext;
+
+    /*!
+    Previous state of the extended keys (next-regs 0xB0, 0xB1)
+    */
+    uint8_t uiExtKeys[2];
   } tPriv;
   
 } kbdstate_t;
@@ -257,7 +432,8 @@ This function opens access to a keyboard.
 uint8_t kbd_open(kbdstate_t* pState, uint8_t uiIndex);
 
 /*!
-This function reads the current state of a keyboard.
+This function reads the current state of a keyboard. All keys, that were
+pressed or released since the last call, are added to the event queue.
 @param pState Pointer to device-structure
 @return EOK = no error
 */
@@ -271,6 +447,151 @@ With this function it can be checked, if a key is pressed.
 */
 uint8_t kbd_pressed(kbdstate_t* pState, uint16_t uiScanCode);
 
+/*!
+Check, if any key of a set is pressed.
+@param pState Pointer to device-structure
+@param pSet Set of keys (see "KBD_KEYSET")
+@return "true" = at least one key of the set is pressed
+*/
+bool kbd_any(kbdstate_t* pState, const kbdset_t* pSet);
+
+/*!
+Check, if all keys of a set are pressed (i.e. a key combination).
+@param pState Pointer to device-structure
+@param pSet Set of keys (see "KBD_KEYSET")
+@return "true" = all keys of the set are pressed
+*/
+bool kbd_all(kbdstate_t* pState, const kbdset_t* pSet);
+
+/*!
+Get the pressed keys of a set as a compact bitfield: BIT0 is the first key of
+the set in the order of the keyboard matrix (row 0 .. 7, D0 .. D4), BIT1 the
+second one, ... Keys beyond the 8th key of the set are ignored.
+@code
+  // Q, A, O, P, SPACE in matrix order: A (row 1), Q (2), P (5), O (5), SPACE (7)
+  static const kbdset_t g_tKeys = KBD_KEYSET(KBD_SCANCODE_A, KBD_SCANCODE_Q,
+                                             KBD_SCANCODE_P, KBD_SCANCODE_O,
+                                             KBD_SCANCODE_SPC);
+  uint8_t uiKeys = kbd_match(&tKbd, &g_tKeys);
+  if (uiKeys & 0x01) { down();  }
+  if (uiKeys & 0x02) { up();    }
+  if (uiKeys & 0x04) { right(); }
+  if (uiKeys & 0x08) { left();  }
+  if (uiKeys & 0x10) { fire();  }
+@endcode
+@param pState Pointer to device-structure
+@param pSet Set of keys (see "KBD_KEYSET")
+@return Bitfield of the pressed keys of the set
+*/
+uint8_t kbd_match(kbdstate_t* pState, const kbdset_t* pSet);
+
+/*!
+Read and remove the oldest event from the event queue of a keyboard.
+@code
+  kbdevent_t tEvent;
+  kbd_read(&tKbd);
+  while (kbd_get_event(&tKbd, &tEvent))
+  {
+    if ((KBD_SCANCODE_SPC == tEvent.uiScanCode) && (KBD_EVENT_DOWN == tEvent.uiType))
+    {
+      ...
+    }
+  }
+@endcode
+@param pState Pointer to device-structure
+@param pEvent Buffer for the event
+@return "true" = event read; "false" = queue is empty
+*/
+bool kbd_get_event(kbdstate_t* pState, kbdevent_t* pEvent);
+
+/*!
+Read the oldest event from the event queue of a keyboard without removing it.
+@param pState Pointer to device-structure
+@param pEvent Buffer for the event
+@return "true" = event read; "false" = queue is empty
+*/
+bool kbd_peek_event(kbdstate_t* pState, kbdevent_t* pEvent);
+
+/*!
+Enable or disable scanning of a keyboard in the background: the keyboard is
+scanned by "kbd_isr()", that has to be called from an interrupt handler of the
+application (i.e. once a frame). While this mode is active, "kbd_read()" does
+not touch the hardware; the state and the events are just read from memory.
+Only one keyboard can be scanned in the background.
+@code
+  IM2_DEFINE_ISR(isr_frame)
+  {
+    kbd_isr();
+  }
+  ...
+  kbd_open(&tKbd, 0);
+  kbd_set_background(&tKbd, true);
+@endcode
+@param pState Pointer to device-structure
+@param bEnable "true" = scan in the background; "false" = scan in "kbd_read()"
+@return EOK = no error
+*/
+uint8_t kbd_set_background(kbdstate_t* pState, bool bEnable);
+
+/*!
+Scan the keyboard, that was registered by "kbd_set_background()". This
+function has to be called from an interrupt handler (frame or line interrupt).
+*/
+void kbd_isr(void);
+
+/*!
+Read the next character from the keyboard. All pending key events are
+translated with the keymap (unshifted, CAPS SHIFT and SYMBOL SHIFT layers,
+CAPS LOCK); a held key is repeated after a delay. The function calls
+"kbd_read()" itself, so it can be called once a frame to feed a line editor.
+@code
+  uint8_t uiChar;
+  while ((uiChar = kbd_get_char(&tKbd)))
+  {
+    editor_insert(uiChar);
+  }
+@endcode
+@param pState Pointer to device-structure
+@return Character or control code (i.e. "KBD_KEY_ENTER"); "0" = no character
+@remark
+"kbd_get_char()" consumes the events of the queue: don't mix it with
+"kbd_get_event()" on the same keyboard.
+*/
+uint8_t kbd_get_char(kbdstate_t* pState) _KBD_FASTCALL;
+
+/*!
+Set the autorepeat of "kbd_get_char()".
+@param pState Pointer to device-structure
+@param uiDelay Delay until a held key is repeated in frames ("0" = no repeat)
+@param uiRate Period of the repetition in frames
+@return EOK = no error
+*/
+uint8_t kbd_set_repeat(kbdstate_t* pState, uint8_t uiDelay, uint8_t uiRate);
+
+/*!
+Set the keymap of "kbd_get_char()" (i.e. for a different layout).
+@param pState Pointer to device-structure
+@param pKeymap Table of "uiMAX_KBDKEYMAP" characters; "NULL" = default keymap
+@return EOK = no error
+*/
+uint8_t kbd_set_keymap(kbdstate_t* pState, const uint8_t* pKeymap);
+
+/*!
+Enable or disable the extended keys of the Next keyboard (cursor keys, ";",
+'"', ",", ".", DELETE, EDIT, ...) in "kbd_get_char()". If enabled, the keys
+are read from next-regs 0xB0/0xB1 and their CAPS/SYMBOL SHIFT entries in the
+8x5 matrix are cancelled (next-reg 0x68, BIT4).
+@param pState Pointer to device-structure
+@param bEnable "true" = use next-regs 0xB0/0xB1
+@return EOK = no error
+*/
+uint8_t kbd_set_extended(kbdstate_t* pState, bool bEnable);
+
+/*!
+Default keymap of "kbd_get_char()" (ZX Spectrum Next layout)
+*/
+extern const uint8_t g_acKbdKeymap[uiMAX_KBDKEYMAP];
+
 /*!
 This function closes access to a keyboard.
 @param pState Pointer to device-structure
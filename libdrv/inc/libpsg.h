@@ -39,6 +39,8 @@
 /*============================================================================*/
 /*                               Includes                                     */
 /*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
 
 /*============================================================================*/
 /*                               Macros                                       */
@@ -135,6 +137,38 @@ This macro describes sound core, that should be used: Hold all AY in RESET
 #define PSG_ENV_SHAPE_ATTACK    (1 << 2)
 #define PSG_ENV_SHAPE_CONTINUE  (1 << 3)
 
+#define PSG_REGISTERS (16)      /* Number of registers of a AY-3-8912 */
+
+#define PSG_NOTE_C  (0)         /* psg_calc_note_period, PSG_NOTE */
+#define PSG_NOTE_DB (1)
+#define PSG_NOTE_D  (2)
+#define PSG_NOTE_EB (3)
+#define PSG_NOTE_E  (4)
+#define PSG_NOTE_F  (5)
+#define PSG_NOTE_GB (6)
+#define PSG_NOTE_G  (7)
+#define PSG_NOTE_AB (8)
+#define PSG_NOTE_A  (9)
+#define PSG_NOTE_BB (10)
+#define PSG_NOTE_B  (11)
+
+/*!
+This macro calculates the number of a note for "psg_voice_note_on" from an
+octave ("1" .. "8") and a note (i.e. "PSG_NOTE_A"): "0" = C1 (32.7 Hz).
+*/
+#define PSG_NOTE(octave, note) ((uint8_t) (((octave) - 1) * 12 + (note)))
+
+/*!
+Number of the highest note ("B8")
+*/
+#define PSG_NOTE_MAX (95)
+
+#define PSG_VOICE_OFF     (0)   /* Phases of the amplitude envelope (ADSR) */
+#define PSG_VOICE_ATTACK  (1)
+#define PSG_VOICE_DECAY   (2)
+#define PSG_VOICE_SUSTAIN (3)
+#define PSG_VOICE_RELEASE (4)
+
 /*============================================================================*/
 /*                               Constants                                    */
 /*============================================================================*/
@@ -172,9 +206,188 @@ typedef struct _psgstate
   /*!
   Buffer for the contents of all registers of AY-3-8912 (used in tracker-mode)
   */
-  uint8_t uiReg[16];
+  uint8_t uiReg[PSG_REGISTERS];
 } psgstate_t;
 
+/*!
+Description of an instrument for the software modulation of a channel
+("psg_voice_*"). Instruments are constant tables, that can be shared by all
+voices.
+*/
+typedef struct _psginstr
+{
+  /*!
+  Amplitude envelope (4.4 fixed point per tick; "0" = immediately):
+  - uiAttack:  increment from current level up to 15
+  - uiDecay:   decrement down to the sustain level
+  - uiSustain: sustain level ("0" .. "15")
+  - uiRelease: decrement down to "0" after "psg_voice_note_off"
+  */
+  uint8_t uiAttack;
+  uint8_t uiDecay;
+  uint8_t uiSustain;
+  uint8_t uiRelease;
+
+  /*!
+  Vibrato:
+  - uiVibDepth: maximum period offset ("0" = no vibrato)
+  - uiVibSpeed: phase increment per tick ("256" = one cycle)
+  - uiVibDelay: number of ticks after "note on" before the vibrato starts
+  */
+  uint8_t uiVibDepth;
+  uint8_t uiVibSpeed;
+  uint8_t uiVibDelay;
+
+  /*!
+  Portamento: change of the period per tick while gliding from the previous
+  note to the new one ("0" = no portamento)
+  */
+  uint8_t uiPorta;
+
+  /*!
+  Arpeggio: table of semitone offsets, one entry per tick, played in a loop
+  ("NULL" = no arpeggio)
+  */
+  const int8_t* pArp;
+
+  /*!
+  Number of entries of "pArp"
+  */
+  uint8_t uiArpLength;
+} psginstr_t;
+
+/*!
+State of the software modulation of one channel of a PSG. All voices of a PSG
+are computed by "psg_voice_tick" (once a frame) and written through the
+register latch of "psgstate_t".
+*/
+typedef struct _psgvoice
+{
+  /*!
+  Channel of the PSG ("PSG_CHANNEL_A" .. "PSG_CHANNEL_C")
+  */
+  uint8_t uiChannel;
+
+  /*!
+  Current instrument
+  */
+  const psginstr_t* pInstr;
+
+  /*!
+  In this internal structure are all the variables, that are required to
+  compute the modulation. This part is not part of the official API and can be
+  changed in future releases.
+  */
+  struct
+  {
+    /*!
+    Current note (see "PSG_NOTE")
+    */
+    uint8_t uiNote;
+
+    /*!
+    Current phase of the amplitude envelope (i.e. "PSG_VOICE_ATTACK")
+    */
+    uint8_t uiPhase;
+
+    /*!
+    Current amplitude (4.4 fixed point)
+    */
+    uint8_t uiLevel;
+
+    /*!
+    Current index in the arpeggio table
+    */
+    uint8_t uiArpPos;
+
+    /*!
+    Current phase of the vibrato
+    */
+    uint8_t uiVibPhase;
+
+    /*!
+    Remaining ticks until the vibrato starts
+    */
+    uint8_t uiVibDelay;
+
+    /*!
+    Current offset of the period from the portamento
+    */
+    int16_t iGlide;
+
+    /*!
+    Current offset of the period from pitch bending
+    */
+    int16_t iBend;
+
+    /*!
+    Change of "iBend" per tick
+    */
+    int8_t iBendStep;
+  } tPriv;
+} psgvoice_t;
+
+/*!
+Snapshot of all registers of a PSG (see "psg_snapshot", "psg_restore")
+*/
+typedef struct _psgsnapshot
+{
+  /*!
+  Contents of the registers of the AY-3-8912
+  */
+  uint8_t uiReg[PSG_REGISTERS];
+} psgsnapshot_t;
+
+/*!
+State of a crossfade between two snapshots of a PSG (see "psg_crossfade_*").
+The first half of the frames fades out "pFrom", the second half fades in "pTo".
+*/
+typedef struct _psgfade
+{
+  /*!
+  PSG to fade
+  */
+  psgstate_t* pState;
+
+  /*!
+  Snapshot to fade out
+  */
+  const psgsnapshot_t* pFrom;
+
+  /*!
+  Snapshot to fade in
+  */
+  const psgsnapshot_t* pTo;
+
+  /*!
+  Duration of the crossfade in frames
+  */
+  uint8_t uiFrames;
+
+  /*!
+  Current frame ("uiFrame == uiFrames": crossfade finished)
+  */
+  uint8_t uiFrame;
+
+  /*!
+  In this internal structure are all the variables, that are required to
+  compute the amplitude ramps. This part is not part of the official API and
+  can be changed in future releases.
+  */
+  struct
+  {
+    /*!
+    Current gain (8.8 fixed point; "16.0" = full amplitude)
+    */
+    uint16_t uiGain;
+
+    /*!
+    Change of the gain per frame (8.8 fixed point)
+    */
+    uint16_t uiStep;
+  } tPriv;
+} psgfade_t;
+
 /*============================================================================*/
 /*                               Prototypes                                   */
 /*============================================================================*/
@@ -437,6 +650,181 @@ Set the shape of the amplitude envolpe.
 */
 uint8_t psg_set_envelope_shape(psgstate_t* pState, uint8_t uiShape);
 
+/*!
+Write a block of consecutive registers of the PSG at once (i.e. a complete
+register set of a tracker-frame). The PSG is selected only once and the values
+are written by an unrolled sequence of OUT-instructions.
+@code
+  static const uint8_t acFrame[] = {0x1C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x0F};
+  psg_write_regs(&tState, 0, sizeof(acFrame), acFrame);
+@endcode
+@param pState Pointer to device structure
+@param uiFirst Index of the first register to write ("0" .. "15")
+@param uiCount Number of registers to write
+@param pValues Values to write
+@return EOK = no error; ERANGE = uiFirst + uiCount exceeds the register file
+*/
+uint8_t psg_write_regs(psgstate_t* pState, uint8_t uiFirst, uint8_t uiCount, const uint8_t* pValues);
+
+/*!
+Write the same block of consecutive registers to several PSGs (Turbosound).
+@code
+  psgstate_t* apPsg[] = {&tPsg0, &tPsg1, &tPsg2};
+  psg_broadcast(apPsg, 3, 0, PSG_REGISTERS, acRegs);
+@endcode
+@param pStates Array of pointers to device structures
+@param uiStates Number of entries in "pStates"
+@param uiFirst Index of the first register to write ("0" .. "15")
+@param uiCount Number of registers to write
+@param pValues Values to write
+@return EOK = no error
+*/
+uint8_t psg_broadcast(psgstate_t* const* pStates, uint8_t uiStates, uint8_t uiFirst, uint8_t uiCount, const uint8_t* pValues);
+
+/*!
+Calculate the period value for a channel of the PSG from a note.
+@param uiNote Number of the note (see "PSG_NOTE"; "0" = C1 .. "95" = B8)
+@return Period value for a channel of the PSG
+*/
+uint16_t psg_calc_note_period(uint8_t uiNote) __z88dk_fastcall;
+
+/*!
+Initialize the software modulation of a channel of the PSG.
+@code
+  static const int8_t acMajor[] = {0, 4, 7};
+  static const psginstr_t tLead = {0x40, 0x08, 10, 0x10, 6, 24, 25, 0, acMajor, 3};
+
+  psgvoice_t atVoice[3];
+  psg_voice_init(&atVoice[0], PSG_CHANNEL_A);
+  psg_voice_set_instrument(&atVoice[0], &tLead);
+  psg_voice_note_on(&atVoice[0], PSG_NOTE(4, PSG_NOTE_A));
+  ...
+  psg_voice_tick(&tState, atVoice, 1);     (once a frame)
+@endcode
+@param pVoice Pointer to the voice structure
+@param uiChannel Channel of the PSG ("PSG_CHANNEL_A" .. "PSG_CHANNEL_C")
+@return EOK = no error
+*/
+uint8_t psg_voice_init(psgvoice_t* pVoice, uint8_t uiChannel);
+
+/*!
+Set the instrument of a voice.
+@param pVoice Pointer to the voice structure
+@param pInstr Instrument (has to be valid while the voice is used)
+@return EOK = no error
+*/
+uint8_t psg_voice_set_instrument(psgvoice_t* pVoice, const psginstr_t* pInstr);
+
+/*!
+Start a note on a voice (attack phase). If the instrument uses portamento and
+the voice is sounding, the period glides from the previous note.
+@param pVoice Pointer to the voice structure
+@param uiNote Number of the note (see "PSG_NOTE")
+@return EOK = no error
+*/
+uint8_t psg_voice_note_on(psgvoice_t* pVoice, uint8_t uiNote);
+
+/*!
+Release the note of a voice (release phase).
+@param pVoice Pointer to the voice structure
+@return EOK = no error
+*/
+uint8_t psg_voice_note_off(psgvoice_t* pVoice) __z88dk_fastcall;
+
+/*!
+Start a pitch bend (slide) on a voice; the bend is reset by the next note.
+@param pVoice Pointer to the voice structure
+@param iStep Change of the period per tick ("< 0" = up, "> 0" = down)
+@return EOK = no error
+*/
+uint8_t psg_voice_bend(psgvoice_t* pVoice, int8_t iStep);
+
+/*!
+Compute the next tick (frame) of all voices of a PSG: amplitude envelope,
+arpeggio, portamento, bend and vibrato. The results are written to the
+register latch and from there to the PSG with two block writes (tone periods,
+amplitudes).
+@param pState Pointer to device structure
+@param pVoices Array of voices of this PSG
+@param uiCount Number of voices ("1" .. "3")
+@return EOK = no error
+*/
+uint8_t psg_voice_tick(psgstate_t* pState, psgvoice_t* pVoices, uint8_t uiCount);
+
+/*!
+Save all registers of a PSG (from the register latch) into a snapshot.
+@param pState Pointer to device structure
+@param pSnap Snapshot to fill
+@return EOK = no error
+*/
+uint8_t psg_snapshot(psgstate_t* pState, psgsnapshot_t* pSnap);
+
+/*!
+Restore all registers (0 .. 13) of a PSG from a snapshot with one block write.
+@param pState Pointer to device structure
+@param pSnap Snapshot to restore
+@return EOK = no error
+@remark
+The envelope generator is restarted by the write to register 13.
+*/
+uint8_t psg_restore(psgstate_t* pState, const psgsnapshot_t* pSnap);
+
+/*!
+Save the registers of several PSGs (i.e. the whole Turbosound set).
+@code
+  psgstate_t* apPsg[] = {&tPsg0, &tPsg1, &tPsg2};
+  psgsnapshot_t atMusic[3];
+  psg_snapshot_all(apPsg, 3, atMusic);
+  ...
+  psg_restore_all(apPsg, 3, atMusic);
+@endcode
+@param pStates Array of pointers to device structures
+@param uiStates Number of entries in "pStates"
+@param pSnaps Array of "uiStates" snapshots to fill
+@return EOK = no error
+*/
+uint8_t psg_snapshot_all(psgstate_t* const* pStates, uint8_t uiStates, psgsnapshot_t* pSnaps);
+
+/*!
+Restore the registers of several PSGs (i.e. the whole Turbosound set).
+@param pStates Array of pointers to device structures
+@param uiStates Number of entries in "pStates"
+@param pSnaps Array of "uiStates" snapshots to restore
+@return EOK = no error
+*/
+uint8_t psg_restore_all(psgstate_t* const* pStates, uint8_t uiStates, const psgsnapshot_t* pSnaps);
+
+/*!
+Start a crossfade between two snapshots of a PSG. The amplitudes of "pFrom"
+are ramped down during the first half of the frames, then all registers of
+"pTo" are written at once and its amplitudes are ramped up.
+@code
+  psgfade_t tFade;
+  psg_crossfade_start(&tFade, &tPsg, &tMusic, &tJingle, 25);
+  while (psg_crossfade_tick(&tFade))
+  {
+    intrinsic_halt();
+  }
+@endcode
+@param pFade Pointer to the crossfade structure
+@param pState Pointer to device structure
+@param pFrom Snapshot to fade out
+@param pTo Snapshot to fade in
+@param uiFrames Duration in frames ("< 2": "pTo" is restored immediately)
+@return EOK = no error
+@remark
+Channels, that use the envelope generator, are faded with a fixed amplitude.
+*/
+uint8_t psg_crossfade_start(psgfade_t* pFade, psgstate_t* pState, const psgsnapshot_t* pFrom, const psgsnapshot_t* pTo, uint8_t uiFrames);
+
+/*!
+Compute the next frame of a crossfade (call once a frame). Each frame costs a
+single block write of the tone, noise, mixer and amplitude registers.
+@param pFade Pointer to the crossfade structure
+@return "true" = crossfade running; "false" = crossfade finished
+*/
+bool psg_crossfade_tick(psgfade_t* pFade) __z88dk_fastcall;
+
 /*!
 This function stops access to a Programmable Sound Generator.
 @param pState Pointer to device-structure
@@ -0,0 +1,86 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: dac_calc_prescaler.c                                               |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for digital sample playback (8-bit DACs fed by zxnDMA)                |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include "libdac.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* dac_calc_prescaler()                                                       */
+/*----------------------------------------------------------------------------*/
+uint8_t dac_calc_prescaler(uint16_t uiRate)
+{
+  if ((DAC_RATE_MIN <= uiRate) && (DAC_RATE_MAX >= uiRate))
+  {
+    return (uint8_t) ((DAC_CLOCK_DMA + (uiRate >> 1)) / uiRate);
+  }
+
+  return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,97 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: dac_close.c                                                        |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for digital sample playback (8-bit DACs fed by zxnDMA)                |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include "libdac.h"
+#include "dac_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* dac_close()                                                                */
+/*----------------------------------------------------------------------------*/
+uint8_t dac_close(dacstate_t* pState)
+{
+  if (pState)
+  {
+    register uint8_t uiScratch;
+
+    dac_stop(pState);
+
+    uiScratch  = ZXN_READ_REG(REG_PERIPHERAL_3) & ~DAC_PERIPHERAL3_ENABLE;
+    uiScratch |= pState->tPriv.uiPeripheral3 & DAC_PERIPHERAL3_ENABLE;
+    ZXN_WRITE_REG(REG_PERIPHERAL_3, uiScratch);
+
+    return EOK;
+  }
+
+  return EINVAL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,91 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: dac_dma_position.c                                                 |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for digital sample playback (8-bit DACs fed by zxnDMA)                |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include "libdac.h"
+#include "dac_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* dac_dma_position()                                                         */
+/*----------------------------------------------------------------------------*/
+uint16_t dac_dma_position(void)
+{
+  register uint16_t uiAddr;
+
+  IO_DAC_DMA = DMA_CMD_READ_MASK;
+  IO_DAC_DMA = DMA_RD_PORT_A;
+  IO_DAC_DMA = DMA_CMD_READ_SEQ;
+
+  uiAddr  = IO_DAC_DMA;
+  uiAddr |= ((uint16_t) IO_DAC_DMA) << 8;
+
+  return uiAddr;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
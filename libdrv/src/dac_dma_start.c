@@ -0,0 +1,103 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: dac_dma_start.c                                                    |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for digital sample playback (8-bit DACs fed by zxnDMA)                |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include "libdac.h"
+#include "dac_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* dac_dma_start()                                                            */
+/*----------------------------------------------------------------------------*/
+void dac_dma_start(const uint8_t* pData, uint16_t uiLength, uint8_t uiPort, uint8_t uiPrescaler, uint8_t uiMode)
+{
+  IO_DAC_DMA = DMA_CMD_DISABLE;
+
+  IO_DAC_DMA = DMA_WR0_A_TO_B;
+  IO_DAC_DMA = (uint8_t) (((uint16_t) pData) & 0xFF);
+  IO_DAC_DMA = (uint8_t) (((uint16_t) pData) >> 8);
+  IO_DAC_DMA = (uint8_t) (uiLength & 0xFF);
+  IO_DAC_DMA = (uint8_t) (uiLength >> 8);
+
+  IO_DAC_DMA = DMA_WR1_MEM_INC;
+
+  IO_DAC_DMA = DMA_WR2_IO_FIXED;
+  IO_DAC_DMA = DMA_WR2_TIMING;
+  IO_DAC_DMA = uiPrescaler;
+
+  IO_DAC_DMA = DMA_WR4_BURST;
+  IO_DAC_DMA = uiPort;
+  IO_DAC_DMA = 0x00;
+
+  IO_DAC_DMA = uiMode;
+
+  IO_DAC_DMA = DMA_CMD_LOAD;
+  IO_DAC_DMA = DMA_CMD_ENABLE;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,143 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: dac_internal.h                                                     |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for digital sample playback (8-bit DACs fed by zxnDMA)                |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__DAC_INTERNAL_H__)
+  #define __DAC_INTERNAL_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include "libdac.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+/*--- Commands and register values of the zxnDMA ----------------------------*/
+#define DMA_CMD_DISABLE     (0x83)  /* WR6: disable DMA */
+#define DMA_CMD_ENABLE      (0x87)  /* WR6: enable DMA */
+#define DMA_CMD_LOAD        (0xCF)  /* WR6: load start addresses */
+#define DMA_CMD_READ_MASK   (0xBB)  /* WR6: read mask follows */
+#define DMA_CMD_READ_SEQ    (0xA7)  /* WR6: initiate read sequence */
+#define DMA_CMD_READ_STATUS (0xBF)  /* WR6: read status byte */
+#define DMA_WR0_A_TO_B      (0x7D)  /* A -> B; port A address, length follow */
+#define DMA_WR1_MEM_INC     (0x14)  /* port A: memory, incremented */
+#define DMA_WR2_IO_FIXED    (0x68)  /* port B: IO, fixed; timing byte follows */
+#define DMA_WR2_TIMING      (0x22)  /* cycle length 2; prescaler follows */
+#define DMA_WR4_BURST       (0xCD)  /* burst mode; port B address follows */
+#define DMA_WR5_STOP        (0x82)  /* stop at end of block */
+#define DMA_WR5_RESTART     (0xA2)  /* auto restart at end of block */
+#define DMA_RD_PORT_A       (0x18)  /* read mask: port A address (lo, hi) */
+#define DMA_STATUS_END      (0x20)  /* status: "0" = end of block reached */
+
+/*!
+Enable bit of the 8-bit DACs in next-reg "PERIPHERAL3" (0x08)
+*/
+#define DAC_PERIPHERAL3_ENABLE (0x08)
+
+/*!
+Number of the first MMU next-reg (slot 0, 0x0000 .. 0x1FFF)
+*/
+#if !defined(REG_MMU0)
+  #define REG_MMU0 (0x50)
+#endif
+
+/*!
+Size of a 8K-page
+*/
+#define DAC_PAGE_SIZE (0x2000)
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+/*!
+IO-port of the zxnDMA (zxnDMA mode)
+*/
+__sfr __at 0x6B IO_DAC_DMA;
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+/*!
+Program the zxnDMA to transfer a block of memory to an IO-port (DAC), timed by
+the prescaler, and start the transfer.
+@param pData First byte to transfer
+@param uiLength Number of bytes to transfer
+@param uiPort IO-port of the DAC
+@param uiPrescaler Prescaler ("DAC_CLOCK_DMA / sample rate")
+@param uiMode "DMA_WR5_STOP" or "DMA_WR5_RESTART"
+*/
+void dac_dma_start(const uint8_t* pData, uint16_t uiLength, uint8_t uiPort, uint8_t uiPrescaler, uint8_t uiMode);
+
+/*!
+Read the current source address (port A) of the zxnDMA.
+@return Address of the next byte, that is transferred
+*/
+uint16_t dac_dma_position(void);
+
+/*!
+Read the status byte of the zxnDMA.
+@return Status byte ("00E1101T")
+*/
+uint8_t dac_dma_status(void);
+
+/*!
+Refill the half of the double buffer, that has been played by the zxnDMA, from
+the 8K-pages of the stream. The end of the playback is detected here.
+@param pState Pointer to device structure
+*/
+void dac_refill(dacstate_t* pState) __z88dk_fastcall;
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __DAC_INTERNAL_H__ */
@@ -0,0 +1,106 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: dac_play.c                                                         |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for digital sample playback (8-bit DACs fed by zxnDMA)                |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <errno.h>
+#include "libdac.h"
+#include "dac_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* dac_play()                                                                 */
+/*----------------------------------------------------------------------------*/
+uint8_t dac_play(dacstate_t* pState, const uint8_t* pData, uint16_t uiLength, uint16_t uiRate, uint8_t uiMode)
+{
+  if (pState && pData && uiLength)
+  {
+    uint8_t uiPrescaler = dac_calc_prescaler(uiRate);
+
+    if (uiPrescaler)
+    {
+      if (DAC_PLAY_LOOP == uiMode)
+      {
+        pState->uiState = DAC_STATE_LOOP;
+        dac_dma_start(pData, uiLength, pState->uiPort, uiPrescaler, DMA_WR5_RESTART);
+      }
+      else
+      {
+        pState->uiState = DAC_STATE_PLAY;
+        dac_dma_start(pData, uiLength, pState->uiPort, uiPrescaler, DMA_WR5_STOP);
+      }
+
+      return EOK;
+    }
+
+    return ERANGE;
+  }
+
+  return EINVAL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
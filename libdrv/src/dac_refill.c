@@ -0,0 +1,152 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: dac_refill.c                                                       |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for digital sample playback (8-bit DACs fed by zxnDMA)                |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <string.h>
+#include <arch/zxn.h>
+#include "libzxn.h"
+#include "libdac.h"
+#include "dac_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* dac_refill()                                                               */
+/*----------------------------------------------------------------------------*/
+void dac_refill(dacstate_t* pState) __z88dk_fastcall
+{
+  uint8_t* pDst;
+  uint8_t* pSrc;
+  uint16_t uiSize;
+  uint16_t uiChunk;
+  uint8_t  uiMmu;
+
+  if (!pState->tPriv.uiRemain)
+  {
+    /* end of stream is already in the buffer */
+    if (!(--pState->tPriv.uiDrain))
+    {
+      dac_stop(pState);
+      return;
+    }
+  }
+
+  pDst   = pState->tPriv.pBuffer + (pState->tPriv.uiFill ? pState->tPriv.uiHalf : 0);
+  pSrc   = (uint8_t*) zxn_memmap(((uint16_t) pState->uiSlot) << 13);
+  uiSize = pState->tPriv.uiHalf;
+
+  if (pState->tPriv.uiRemain)
+  {
+    uiMmu = ZXN_READ_REG(REG_MMU0 + pState->uiSlot);
+
+    while (uiSize && pState->tPriv.uiRemain)
+    {
+      uiChunk = DAC_PAGE_SIZE - pState->tPriv.uiOffset;
+
+      if (uiChunk > uiSize)
+      {
+        uiChunk = uiSize;
+      }
+
+      if (uiChunk > pState->tPriv.uiRemain)
+      {
+        uiChunk = (uint16_t) pState->tPriv.uiRemain;
+      }
+
+      ZXN_WRITE_REG(REG_MMU0 + pState->uiSlot, pState->tPriv.uiPage);
+      memcpy(pDst, pSrc + pState->tPriv.uiOffset, uiChunk);
+
+      pDst   += uiChunk;
+      uiSize -= uiChunk;
+      pState->tPriv.uiRemain -= uiChunk;
+      pState->tPriv.uiOffset += uiChunk;
+
+      if (DAC_PAGE_SIZE == pState->tPriv.uiOffset)
+      {
+        pState->tPriv.uiOffset = 0;
+        ++pState->tPriv.uiPage;
+      }
+    }
+
+    ZXN_WRITE_REG(REG_MMU0 + pState->uiSlot, uiMmu);
+
+    if (!pState->tPriv.uiRemain)
+    {
+      /* play this half and the following (silent) one */
+      pState->tPriv.uiDrain = 2;
+    }
+  }
+
+  if (uiSize)
+  {
+    memset(pDst, DAC_SILENCE, uiSize);
+  }
+
+  pState->tPriv.uiFill ^= 1;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,112 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: dac_stream.c                                                       |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for digital sample playback (8-bit DACs fed by zxnDMA)                |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <errno.h>
+#include "libdac.h"
+#include "dac_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* dac_stream()                                                               */
+/*----------------------------------------------------------------------------*/
+uint8_t dac_stream(dacstate_t* pState, uint8_t uiPage, uint16_t uiOffset, uint32_t uiLength, uint16_t uiRate, uint8_t* pBuffer, uint16_t uiSize)
+{
+  if (pState && pBuffer && uiLength && (uiSize >= 2) && (DAC_PAGE_SIZE > uiOffset))
+  {
+    uint8_t uiPrescaler = dac_calc_prescaler(uiRate);
+
+    if (uiPrescaler)
+    {
+      dac_stop(pState);
+
+      pState->tPriv.pBuffer  = pBuffer;
+      pState->tPriv.uiHalf   = uiSize >> 1;
+      pState->tPriv.uiFill   = 0;
+      pState->tPriv.uiPage   = uiPage;
+      pState->tPriv.uiOffset = uiOffset;
+      pState->tPriv.uiRemain = uiLength;
+      pState->tPriv.uiDrain  = 0;
+      pState->uiState = DAC_STATE_STREAM;
+
+      /* prefill both halves; the DMA plays them in a loop */
+      dac_refill(pState);
+      dac_refill(pState);
+
+      dac_dma_start(pBuffer, pState->tPriv.uiHalf << 1, pState->uiPort, uiPrescaler, DMA_WR5_RESTART);
+
+      return EOK;
+    }
+
+    return ERANGE;
+  }
+
+  return EINVAL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,141 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: input_internal.h                                                   |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Unified input of keyboard, mouse and joysticks                               |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__INPUT_INTERNAL_H__)
+  #define __INPUT_INTERNAL_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "libinput.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+/*!
+Groups of the input, that are stored in a record of an input log (mask)
+*/
+#define INPUT_REC_KEYS      (0x01)  /* tKeys */
+#define INPUT_REC_JOYS      (0x02)  /* uiJoy */
+#define INPUT_REC_MOUSE_POS (0x04)  /* iMouseX, iMouseY */
+#define INPUT_REC_MOUSE_BTN (0x08)  /* uiMouseBtn, uiMouseWhl */
+
+/*!
+Number of groups of a record
+*/
+#define INPUT_REC_GROUPS (4)
+
+/*!
+Maximum run length of a record ("0" = end of log)
+*/
+#define INPUT_REC_MAX_RUN (255)
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+/*!
+Offset and size of the groups of a record in "inputsample_t"
+*/
+extern const uint8_t g_acInputGroup[INPUT_REC_GROUPS][2];
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+/*!
+Append the input of one frame to a log.
+@param pLog Pointer to log-structure (recording)
+@param pSample Input of the frame
+@return EOK = no error; ERANGE = memory log is full; EBADF = file could not be
+        written (recording ends)
+*/
+uint8_t input_log_write(inputlog_t* pLog, const inputsample_t* pSample);
+
+/*!
+Read the input of the next frame from a log.
+@param pLog Pointer to log-structure (replay)
+@param pSample Buffer for the input of the frame
+@return "true" = input read; "false" = end of log (replay ends)
+*/
+bool input_log_read(inputlog_t* pLog, inputsample_t* pSample);
+
+/*!
+Write the pending record to a log.
+@param pLog Pointer to log-structure (recording)
+@return EOK = no error; error of "input_log_put()"
+*/
+uint8_t input_log_flush(inputlog_t* pLog) __z88dk_fastcall;
+
+/*!
+Write bytes to a log (memory or cache of the file).
+@param pLog Pointer to log-structure
+@param pData Data to write
+@param uiSize Number of bytes
+@return EOK = no error; ERANGE = memory log is full; EBADF = file could not be
+        written (the mode of the log changes to "INPUT_LOG_IDLE")
+*/
+uint8_t input_log_put(inputlog_t* pLog, const void* pData, uint8_t uiSize);
+
+/*!
+Read bytes from a log (memory or cache of the file).
+@param pLog Pointer to log-structure
+@param pData Buffer for the data
+@param uiSize Number of bytes
+@return "true" = bytes read; "false" = end of log
+*/
+bool input_log_get(inputlog_t* pLog, void* pData, uint8_t uiSize);
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __INPUT_INTERNAL_H__ */
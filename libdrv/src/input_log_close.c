@@ -0,0 +1,120 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: input_log_close.c                                                  |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Unified input of keyboard, mouse and joysticks                               |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <errno.h>
+#include <arch/zxn/esxdos.h>
+#include "libzxn.h"
+#include "libinput.h"
+#include "input_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* input_log_close()                                                          */
+/*----------------------------------------------------------------------------*/
+uint8_t input_log_close(inputlog_t* pLog) __z88dk_fastcall
+{
+  if (pLog)
+  {
+    uint8_t uiResult = EOK;
+
+    if (INPUT_LOG_RECORD == pLog->uiMode)
+    {
+      const uint8_t uiEnd = 0;
+
+      uiResult = input_log_flush(pLog);
+
+      if (EOK == uiResult)
+      {
+        uiResult = input_log_put(pLog, &uiEnd, sizeof(uiEnd));
+      }
+
+      if ((EOK == uiResult) && (INV_FILE_HND != pLog->hFile) && pLog->uiPos)
+      {
+        if (pLog->uiPos != esx_f_write(pLog->hFile, pLog->pBuffer, pLog->uiPos))
+        {
+          uiResult = EBADF;
+        }
+      }
+    }
+
+    if (INV_FILE_HND != pLog->hFile)
+    {
+      esx_f_close(pLog->hFile);
+      pLog->hFile = INV_FILE_HND;
+    }
+
+    pLog->uiMode = INPUT_LOG_IDLE;
+
+    return uiResult;
+  }
+
+  return EINVAL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,114 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: input_log_get.c                                                    |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Unified input of keyboard, mouse and joysticks                               |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <arch/zxn/esxdos.h>
+#include "libzxn.h"
+#include "libinput.h"
+#include "input_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* input_log_get()                                                            */
+/*----------------------------------------------------------------------------*/
+bool input_log_get(inputlog_t* pLog, void* pData, uint8_t uiSize)
+{
+  register uint8_t uiCount;
+
+  while (uiSize)
+  {
+    if (pLog->uiPos >= pLog->tPriv.uiLength)
+    {
+      if (INV_FILE_HND == pLog->hFile)
+      {
+        return false;
+      }
+
+      pLog->tPriv.uiLength = esx_f_read(pLog->hFile, pLog->pBuffer, pLog->uiSize);
+      pLog->uiPos = 0;
+
+      if ((0 == pLog->tPriv.uiLength) || (0xFFFF == pLog->tPriv.uiLength))
+      {
+        return false;
+      }
+    }
+
+    uiCount = ((pLog->tPriv.uiLength - pLog->uiPos) < uiSize) ? (uint8_t) (pLog->tPriv.uiLength - pLog->uiPos) : uiSize;
+
+    memcpy(pData, pLog->pBuffer + pLog->uiPos, uiCount);
+    pLog->uiPos += uiCount;
+    pData = (uint8_t*) pData + uiCount;
+    uiSize -= uiCount;
+  }
+
+  return true;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
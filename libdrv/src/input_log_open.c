@@ -0,0 +1,112 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: input_log_open.c                                                   |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Unified input of keyboard, mouse and joysticks                               |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <arch/zxn/esxdos.h>
+#include "libzxn.h"
+#include "libinput.h"
+#include "input_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* input_log_open()                                                           */
+/*----------------------------------------------------------------------------*/
+uint8_t input_log_open(inputlog_t* pLog, uint8_t uiMode, uint8_t* pBuffer, uint16_t uiSize, const char_t* acFile)
+{
+  if (pLog && pBuffer && uiSize && ((INPUT_LOG_RECORD == uiMode) || (INPUT_LOG_REPLAY == uiMode)))
+  {
+    memset(pLog, 0, sizeof(inputlog_t));
+    pLog->pBuffer = pBuffer;
+    pLog->uiSize  = uiSize;
+    pLog->hFile   = INV_FILE_HND;
+
+    if (acFile)
+    {
+      pLog->hFile = esx_f_open((char*) acFile, (INPUT_LOG_RECORD == uiMode) ? (ESX_MODE_W | ESX_MODE_OPEN_CREAT_TRUNC) : ESX_MODE_R);
+
+      if (INV_FILE_HND == pLog->hFile)
+      {
+        return EBADF;
+      }
+    }
+    else if (INPUT_LOG_REPLAY == uiMode)
+    {
+      pLog->tPriv.uiLength = uiSize;  /* the whole log is in memory */
+    }
+
+    pLog->uiMode = uiMode;
+
+    return EOK;
+  }
+
+  return EINVAL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,111 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: input_log_put.c                                                    |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Unified input of keyboard, mouse and joysticks                               |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <arch/zxn/esxdos.h>
+#include "libzxn.h"
+#include "libinput.h"
+#include "input_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* input_log_put()                                                            */
+/*----------------------------------------------------------------------------*/
+uint8_t input_log_put(inputlog_t* pLog, const void* pData, uint8_t uiSize)
+{
+  if ((pLog->uiSize - pLog->uiPos) < uiSize)
+  {
+    if (INV_FILE_HND == pLog->hFile)
+    {
+      return ERANGE;
+    }
+
+    /* A short write (disk full, error) ends the recording */
+    if (pLog->uiPos != esx_f_write(pLog->hFile, pLog->pBuffer, pLog->uiPos))
+    {
+      pLog->uiMode = INPUT_LOG_IDLE;
+      return EBADF;
+    }
+
+    pLog->uiPos = 0;
+
+    if (pLog->uiSize < uiSize)
+    {
+      return ERANGE;
+    }
+  }
+
+  memcpy(pLog->pBuffer + pLog->uiPos, pData, uiSize);
+  pLog->uiPos += uiSize;
+
+  return EOK;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,114 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: input_log_read.c                                                   |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Unified input of keyboard, mouse and joysticks                               |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "libinput.h"
+#include "input_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* input_log_read()                                                           */
+/*----------------------------------------------------------------------------*/
+bool input_log_read(inputlog_t* pLog, inputsample_t* pSample)
+{
+  uint8_t acHeader[2];
+
+  if (0 == pLog->tPriv.uiRun)
+  {
+    /* Next record: run length, mask and the changed groups */
+    if (!input_log_get(pLog, acHeader, 1) || (0 == acHeader[0]) || !input_log_get(pLog, acHeader + 1, 1))
+    {
+      pLog->uiMode = INPUT_LOG_IDLE;
+      return false;
+    }
+
+    for (uint8_t i = 0; i < INPUT_REC_GROUPS; ++i)
+    {
+      if (acHeader[1] & (1 << i))
+      {
+        if (!input_log_get(pLog, ((uint8_t*) &pLog->tPriv.tSample) + g_acInputGroup[i][0], g_acInputGroup[i][1]))
+        {
+          pLog->uiMode = INPUT_LOG_IDLE;
+          return false;
+        }
+      }
+    }
+
+    pLog->tPriv.uiRun = acHeader[0];
+  }
+
+  --pLog->tPriv.uiRun;
+  ++pLog->uiFrames;
+  memcpy(pSample, &pLog->tPriv.tSample, sizeof(inputsample_t));
+
+  return true;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,167 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: input_log_write.c                                                  |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Unified input of keyboard, mouse and joysticks                               |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <errno.h>
+#include "libinput.h"
+#include "input_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+/*!
+Offset and size of the groups of a record in "inputsample_t"
+*/
+const uint8_t g_acInputGroup[INPUT_REC_GROUPS][2] =
+{
+  { offsetof(inputsample_t, tKeys),      sizeof(kbdrows_t)           },
+  { offsetof(inputsample_t, uiJoy),      2 * uiMAX_INPUTPADS         },
+  { offsetof(inputsample_t, iMouseX),    2 * sizeof(int16_t)         },
+  { offsetof(inputsample_t, uiMouseBtn), 2 * sizeof(uint8_t)         }
+};
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* input_log_write()                                                          */
+/*----------------------------------------------------------------------------*/
+uint8_t input_log_write(inputlog_t* pLog, const inputsample_t* pSample)
+{
+  ++pLog->uiFrames;
+
+  if (pLog->tPriv.uiRun && (INPUT_REC_MAX_RUN > pLog->tPriv.uiRun) &&
+      (0 == memcmp(pSample, &pLog->tPriv.tSample, sizeof(inputsample_t))))
+  {
+    ++pLog->tPriv.uiRun;
+    return EOK;
+  }
+
+  if (pLog->tPriv.uiRun)
+  {
+    const uint8_t uiResult = input_log_flush(pLog);
+
+    if (EOK != uiResult)
+    {
+      pLog->uiMode = INPUT_LOG_IDLE;
+      return uiResult;
+    }
+  }
+
+  memcpy(&pLog->tPriv.tSample, pSample, sizeof(inputsample_t));
+  pLog->tPriv.uiRun = 1;
+
+  return EOK;
+}
+
+/*----------------------------------------------------------------------------*/
+/* input_log_flush()                                                          */
+/*----------------------------------------------------------------------------*/
+uint8_t input_log_flush(inputlog_t* pLog) __z88dk_fastcall
+{
+  const uint8_t* pSample = (const uint8_t*) &pLog->tPriv.tSample;
+  const uint8_t* pPrev   = (const uint8_t*) &pLog->tPriv.tPrev;
+  uint8_t acHeader[2];
+  uint8_t uiResult;
+
+  if (0 == pLog->tPriv.uiRun)
+  {
+    return EOK;
+  }
+
+  /* Run length and mask of the changed groups */
+  acHeader[0] = pLog->tPriv.uiRun;
+  acHeader[1] = 0;
+
+  for (uint8_t i = 0; i < INPUT_REC_GROUPS; ++i)
+  {
+    if (memcmp(pSample + g_acInputGroup[i][0], pPrev + g_acInputGroup[i][0], g_acInputGroup[i][1]))
+    {
+      acHeader[1] |= (1 << i);
+    }
+  }
+
+  if (EOK != (uiResult = input_log_put(pLog, acHeader, sizeof(acHeader))))
+  {
+    return uiResult;
+  }
+
+  for (uint8_t i = 0; i < INPUT_REC_GROUPS; ++i)
+  {
+    if (acHeader[1] & (1 << i))
+    {
+      if (EOK != (uiResult = input_log_put(pLog, pSample + g_acInputGroup[i][0], g_acInputGroup[i][1])))
+      {
+        return uiResult;
+      }
+    }
+  }
+
+  memcpy(&pLog->tPriv.tPrev, &pLog->tPriv.tSample, sizeof(inputsample_t));
+  pLog->tPriv.uiRun = 0;
+
+  return EOK;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,240 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: input_poll.c                                                       |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Unified input of keyboard, mouse and joysticks                               |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include "libzxn.h"
+#include "libinput.h"
+#include "input_internal.h"
+#include "kbd_internal.h"
+#include "mouse_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+/*!
+Next-reg of the extended buttons of the MD pads
+*/
+#if !defined(REG_EXT_MD_PAD_BTN)
+  #define REG_EXT_MD_PAD_BTN (0xB2)
+#endif
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+__sfr __at 0x1F IO_INPUT_KJOYSTICK0;
+__sfr __at 0x37 IO_INPUT_KJOYSTICK1;
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* input_poll()                                                               */
+/*----------------------------------------------------------------------------*/
+uint8_t input_poll(inputstate_t* pState, inputframe_t* pFrame)
+{
+  if (pState && pFrame)
+  {
+    inputlog_t* pLog = pState->pLog;
+    inputsample_t tSample;
+    register uint8_t uiValue;
+
+    memset(pFrame, 0, sizeof(inputframe_t));
+    pFrame->uiFrame = (uint16_t) zxn_frames();
+
+    if (pLog && (INPUT_LOG_REPLAY == pLog->uiMode) && input_log_read(pLog, &tSample))
+    {
+      /* Replay: feed keyboard and mouse from the log */
+      if (pState->uiDevices & INPUT_DEV_KBD)
+      {
+        memcpy(&pState->pKbd->tRows, &tSample.tKeys, sizeof(kbdrows_t));
+        kbd_apply(pState->pKbd, pFrame->uiFrame);
+      }
+
+      if (pState->uiDevices & INPUT_DEV_MOUSE)
+      {
+        pState->pMouse->iX = tSample.iMouseX;
+        pState->pMouse->iY = tSample.iMouseY;
+        mouse_apply(pState->pMouse, (tSample.uiMouseWhl << 4) | tSample.uiMouseBtn, pFrame->uiFrame);
+        pState->pMouse->uiBtn = tSample.uiMouseBtn;
+        pState->pMouse->uiWhl = tSample.uiMouseWhl;
+      }
+    }
+    else
+    {
+      memset(&tSample, 0, sizeof(inputsample_t));
+
+      /*
+      Joysticks: Kempston ports 0x1F/0x37 (BIT3:0 = UP, DN, LE, RI; BIT7:4 =
+      START, A, C, B) and next-reg 0xB2 (BIT3:0 = X, Z, Y, MODE of the left pad,
+      BIT7:4 of the right pad) - 0xB2 is read once for both pads
+      */
+      if (pState->uiDevices & (INPUT_DEV_JOY0 | INPUT_DEV_JOY1))
+      {
+        const uint8_t uiExt = ZXN_READ_REG(REG_EXT_MD_PAD_BTN);
+
+        if (pState->uiDevices & INPUT_DEV_JOY0)
+        {
+          uiValue = IO_INPUT_KJOYSTICK0;
+          tSample.uiJoy[0] = uiValue & 0x0F;
+          tSample.uiJoy[1] = (uiValue >> 4) | (uiExt << 4);
+        }
+
+        if (pState->uiDevices & INPUT_DEV_JOY1)
+        {
+          uiValue = IO_INPUT_KJOYSTICK1;
+          tSample.uiJoy[2] = uiValue & 0x0F;
+          tSample.uiJoy[3] = (uiValue >> 4) | (uiExt & 0xF0);
+        }
+      }
+
+      if (pState->uiDevices & INPUT_DEV_KBD)
+      {
+        kbd_read(pState->pKbd);
+        memcpy(&tSample.tKeys, &pState->pKbd->tRows, sizeof(kbdrows_t));
+      }
+
+      if (pState->uiDevices & INPUT_DEV_MOUSE)
+      {
+        mouse_read(pState->pMouse);
+        tSample.iMouseX    = pState->pMouse->iX;
+        tSample.iMouseY    = pState->pMouse->iY;
+        tSample.uiMouseBtn = pState->pMouse->uiBtn;
+        tSample.uiMouseWhl = pState->pMouse->uiWhl;
+      }
+
+      if (pLog && (INPUT_LOG_RECORD == pLog->uiMode))
+      {
+        input_log_write(pLog, &tSample);
+      }
+    }
+
+    /* Joysticks incl. the keys, that are mapped to them */
+    for (uint8_t i = 0; i < uiMAX_INPUTPADS; ++i)
+    {
+      pFrame->uiDir[i] = tSample.uiJoy[2 * i];
+      pFrame->uiBtn[i] = tSample.uiJoy[2 * i + 1];
+
+      if (pState->pJoy[i])
+      {
+        pState->pJoy[i]->uiDir = pFrame->uiDir[i];
+        pState->pJoy[i]->uiBtn = pFrame->uiBtn[i];
+      }
+    }
+
+    if (pState->uiDevices & INPUT_DEV_KBD)
+    {
+      for (uint8_t i = 0; i < uiMAX_KBDROWS; ++i)
+      {
+        uiValue = tSample.tKeys.uiRaw8[i];
+        pFrame->tKeys.uiRaw8[i]     = uiValue;
+        pFrame->tKeysDown.uiRaw8[i] = uiValue & ~pState->tPriv.tKeys.uiRaw8[i];
+        pState->tPriv.tKeys.uiRaw8[i] = uiValue;
+      }
+
+      for (uint8_t i = 0; i < pState->uiMapSize; ++i)
+      {
+        const inputmap_t* pMap = &pState->pMap[i];
+
+        if ((pFrame->tKeys.uiRaw8[pMap->uiScanCode >> 8] & (uint8_t) pMap->uiScanCode) &&
+            (uiMAX_INPUTPADS > pMap->uiPad))
+        {
+          pFrame->uiDir[pMap->uiPad] |= pMap->uiDir;
+          pFrame->uiBtn[pMap->uiPad] |= pMap->uiBtn;
+        }
+      }
+    }
+
+    /* Edges of the joysticks */
+    for (uint8_t i = 0; i < uiMAX_INPUTPADS; ++i)
+    {
+      pFrame->uiDirDown[i] = pFrame->uiDir[i] & ~pState->tPriv.uiDir[i];
+      pFrame->uiDirUp[i]   = pState->tPriv.uiDir[i] & ~pFrame->uiDir[i];
+      pFrame->uiBtnDown[i] = pFrame->uiBtn[i] & ~pState->tPriv.uiBtn[i];
+      pFrame->uiBtnUp[i]   = pState->tPriv.uiBtn[i] & ~pFrame->uiBtn[i];
+
+      pState->tPriv.uiDir[i] = pFrame->uiDir[i];
+      pState->tPriv.uiBtn[i] = pFrame->uiBtn[i];
+    }
+
+    /* Mouse */
+    if (pState->uiDevices & INPUT_DEV_MOUSE)
+    {
+      pFrame->iMouseX        = tSample.iMouseX;
+      pFrame->iMouseY        = tSample.iMouseY;
+      pFrame->iMouseDX       = tSample.iMouseX - pState->tPriv.iMouseX;
+      pFrame->iMouseDY       = tSample.iMouseY - pState->tPriv.iMouseY;
+      pFrame->uiMouseBtn     = tSample.uiMouseBtn;
+      pFrame->uiMouseBtnDown = tSample.uiMouseBtn & ~pState->tPriv.uiMouseBtn;
+      pFrame->uiMouseBtnUp   = pState->tPriv.uiMouseBtn & ~tSample.uiMouseBtn;
+      pFrame->uiMouseWhl     = tSample.uiMouseWhl;
+
+      pState->tPriv.iMouseX    = tSample.iMouseX;
+      pState->tPriv.iMouseY    = tSample.iMouseY;
+      pState->tPriv.uiMouseBtn = tSample.uiMouseBtn;
+    }
+
+    return EOK;
+  }
+
+  return EINVAL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,113 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: input_set_map.c                                                    |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Unified input of keyboard, mouse and joysticks                               |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <errno.h>
+#include "libinput.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+/*!
+Q = up, A = down, O = left, P = right, SPACE = fire
+*/
+const inputmap_t g_tInputMapQAOP[INPUT_MAP_DEFAULT_SIZE] =
+{
+  { KBD_SCANCODE_Q,   0, JOYSTICK_DIR_UP, 0 },
+  { KBD_SCANCODE_A,   0, JOYSTICK_DIR_DN, 0 },
+  { KBD_SCANCODE_O,   0, JOYSTICK_DIR_LE, 0 },
+  { KBD_SCANCODE_P,   0, JOYSTICK_DIR_RI, 0 },
+  { KBD_SCANCODE_SPC, 0, 0, JOYSTICK_BTN_B }
+};
+
+/*!
+Cursor keys: 7 = up, 6 = down, 5 = left, 8 = right, 0 = fire
+*/
+const inputmap_t g_tInputMapCursor[INPUT_MAP_DEFAULT_SIZE] =
+{
+  { KBD_SCANCODE_7, 0, JOYSTICK_DIR_UP, 0 },
+  { KBD_SCANCODE_6, 0, JOYSTICK_DIR_DN, 0 },
+  { KBD_SCANCODE_5, 0, JOYSTICK_DIR_LE, 0 },
+  { KBD_SCANCODE_8, 0, JOYSTICK_DIR_RI, 0 },
+  { KBD_SCANCODE_0, 0, 0, JOYSTICK_BTN_B }
+};
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* input_set_map()                                                            */
+/*----------------------------------------------------------------------------*/
+uint8_t input_set_map(inputstate_t* pState, const inputmap_t* pMap, uint8_t uiSize)
+{
+  if (pState)
+  {
+    pState->pMap      = pMap;
+    pState->uiMapSize = (pMap ? uiSize : 0);
+
+    return EOK;
+  }
+
+  return EINVAL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
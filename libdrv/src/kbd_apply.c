@@ -0,0 +1,113 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: kbd_apply.c                                                        |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for the keyboard                                                      |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include "libkbd.h"
+#include "kbd_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* kbd_apply()                                                                */
+/*----------------------------------------------------------------------------*/
+void kbd_apply(kbdstate_t* pState, uint16_t uiFrame)
+{
+  /* Detect key events */
+  for (uint8_t i = 0; i < uiMAX_KBDROWS; ++i)
+  {
+    if (pState->tRows.uiRaw8[i] != pState->tPriv.tRows.uiRaw8[i])
+    {
+      pState->tPriv.uiScratch  = (pState->tPriv.tRows.uiRaw8[i] ^ pState->tRows.uiRaw8[i]) & KBD_ROW_MASK;
+      pState->tPriv.uiPressed  = pState->tRows.uiRaw8[i]       & pState->tPriv.uiScratch;
+      pState->tPriv.uiReleased = pState->tPriv.tRows.uiRaw8[i] & pState->tPriv.uiScratch;
+
+      for (uint8_t uiKey = 0x01; pState->tPriv.uiPressed | pState->tPriv.uiReleased; uiKey <<= 1)
+      {
+        if (pState->tPriv.uiReleased & 0x01)
+        {
+          kbd_put_event(pState, (((uint16_t) i) << 8) | uiKey, KBD_EVENT_UP, uiFrame);
+        }
+
+        if (pState->tPriv.uiPressed & 0x01)
+        {
+          kbd_put_event(pState, (((uint16_t) i) << 8) | uiKey, KBD_EVENT_DOWN, uiFrame);
+        }
+
+        pState->tPriv.uiPressed  >>= 1;
+        pState->tPriv.uiReleased >>= 1;
+      }
+    }
+  }
+
+  /* Save raw state of the keyboard */
+  for (uint8_t i = 0; i < (uiMAX_KBDROWS / sizeof(uint16_t)); ++i)
+  {
+    pState->tPriv.tRows.uiRaw16[i] = pState->tRows.uiRaw16[i];
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -75,6 +75,8 @@ uint8_t kbd_close(kbdstate_t* pState) _KBD_FASTCALL
 {
   if (pState)
   {
+    kbd_set_background(pState, false);
+    kbd_set_extended(pState, false);
     pState->uiIndex = 0xFF;
     return EOK;
   }
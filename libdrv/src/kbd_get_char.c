@@ -0,0 +1,187 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: kbd_get_char.c                                                     |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for the keyboard                                                      |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <arch/zxn.h>
+#include "libkbd.h"
+#include "kbd_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+/*!
+Read the extended keys of the Next keyboard (next-regs 0xB0, 0xB1) and deliver
+the character of a key, that was pressed since the last call.
+@param pState Pointer to device-structure
+@return Character; "0" = no character
+*/
+static uint8_t kbd_get_extended(kbdstate_t* pState) __z88dk_fastcall;
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* kbd_get_char()                                                             */
+/*----------------------------------------------------------------------------*/
+uint8_t kbd_get_char(kbdstate_t* pState) _KBD_FASTCALL
+{
+  kbdevent_t tEvent;
+  uint8_t uiChar;
+
+  if (!pState)
+  {
+    return 0;
+  }
+
+  kbd_read(pState);
+
+  /* extended keys of the Next keyboard */
+  if (pState->tPriv.uiFlags & KBD_FLAG_EXTENDED)
+  {
+    if ((uiChar = kbd_get_extended(pState)))
+    {
+      return uiChar;
+    }
+  }
+
+  /* keys of the 8x5 matrix */
+  while (kbd_get_event(pState, &tEvent))
+  {
+    if ((uiChar = kbd_translate(pState, &tEvent)))
+    {
+      return uiChar;
+    }
+  }
+
+  /* autorepeat */
+  if (pState->tPriv.uiRepeatChar && pState->tPriv.uiRepeatDelay)
+  {
+    const uint16_t uiNow = kbd_now(pState);
+
+    if (0 <= (int16_t) (uiNow - pState->tPriv.uiRepeatNext))
+    {
+      pState->tPriv.uiRepeatNext = uiNow + pState->tPriv.uiRepeatRate;
+      return pState->tPriv.uiRepeatChar;
+    }
+  }
+
+  return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/* kbd_get_extended()                                                         */
+/*----------------------------------------------------------------------------*/
+static uint8_t kbd_get_extended(kbdstate_t* pState) __z88dk_fastcall
+{
+  uint8_t uiKeys;
+  uint8_t uiPressed;
+  uint8_t uiChar;
+  uint8_t uiIndex;
+
+  for (uint8_t i = 0; i < 2; ++i)
+  {
+    uiKeys = ZXN_READ_REG(KBD_REG_EXTKEYS0 + i);
+
+    /* released keys */
+    pState->tPriv.uiExtKeys[i] &= uiKeys;
+
+    /* repeated extended key was released */
+    uiIndex = (uint8_t) pState->tPriv.uiRepeatCode;
+
+    if (((pState->tPriv.uiRepeatCode & 0xFF00) == KBD_SCANCODE_EXT) &&
+        ((uiIndex >> 3) == i) && !(uiKeys & (1 << (uiIndex & 0x07))))
+    {
+      pState->tPriv.uiRepeatChar = 0;
+      pState->tPriv.uiRepeatCode = 0;
+    }
+
+    /* one new key per call */
+    if ((uiPressed = uiKeys & ~pState->tPriv.uiExtKeys[i]))
+    {
+      uiPressed &= -uiPressed;
+      pState->tPriv.uiExtKeys[i] |= uiPressed;
+
+      for (uiIndex = i << 3; uiPressed > 1; uiPressed >>= 1)
+      {
+        ++uiIndex;
+      }
+
+      uiChar = g_acKbdExtKeymap[uiIndex];
+
+      if (KBD_KEY_CAPSLOCK == uiChar)
+      {
+        pState->tPriv.uiFlags ^= KBD_FLAG_CAPSLOCK;
+        return 0;
+      }
+
+      pState->tPriv.uiRepeatChar = uiChar;
+      pState->tPriv.uiRepeatCode = KBD_SCANCODE_EXT | uiIndex;
+      pState->tPriv.uiRepeatNext = kbd_now(pState) + pState->tPriv.uiRepeatDelay;
+
+      return uiChar;
+    }
+  }
+
+  return 0;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
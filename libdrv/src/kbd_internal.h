@@ -0,0 +1,172 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: kbd_internal.h                                                     |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for the keyboard of the ZX Spectrum Next                              |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__KBD_INTERNAL_H__)
+  #define __KBD_INTERNAL_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include "libkbd.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+/*!
+Flags of "tPriv.uiFlags"
+*/
+#define KBD_FLAG_CAPS     (0x01)  /* CAPS SHIFT is held */
+#define KBD_FLAG_SYMBOL   (0x02)  /* SYMBOL SHIFT is held */
+#define KBD_FLAG_CAPSLOCK (0x04)  /* CAPS LOCK is active */
+#define KBD_FLAG_EXTENDED (0x80)  /* extended keys (0xB0, 0xB1) are used */
+
+/*!
+Next-regs of the extended keys of the Next keyboard
+*/
+#define KBD_REG_EXTKEYS0 (0xB0)
+#define KBD_REG_EXTKEYS1 (0xB1)
+
+/*!
+Next-reg "ULA control"; BIT4 cancels the entries of the extended keys in the
+8x5 matrix
+*/
+#define KBD_REG_ULA_CONTROL (0x68)
+#define KBD_ULA_CANCEL_EXTKEYS (0x10)
+
+/*!
+Scancodes of the extended keys (not part of the 8x5 matrix):
+"KBD_SCANCODE_EXT | index" ("0" .. "15" = BIT0 of 0xB0 .. BIT7 of 0xB1)
+*/
+#define KBD_SCANCODE_EXT (0xFF00)
+
+/*!
+Keys of a row (D0 .. D4); D5 .. D7 are not part of the keyboard matrix
+*/
+#define KBD_ROW_MASK (0x1F)
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+/*!
+Characters of the extended keys (BIT0 of 0xB0 .. BIT7 of 0xB1)
+*/
+extern const uint8_t g_acKbdExtKeymap[16];
+
+/*!
+Keyboard, that is scanned in the background by "kbd_isr()"
+*/
+extern kbdstate_t* g_pKbdIsr;
+
+/*!
+"1" = background scanning by "kbd_isr()" is active
+*/
+extern volatile uint8_t g_uiKbdIsrActive;
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+/*!
+Add an event to the event queue of a keyboard. If the queue is full, the event
+is dropped and counted as lost.
+@param pState Pointer to device-structure
+@param uiScanCode Code of the key
+@param uiType Type of the event ("KBD_EVENT_DOWN", "KBD_EVENT_UP")
+@param uiFrame Timestamp of the event in frames
+*/
+void kbd_put_event(kbdstate_t* pState, uint16_t uiScanCode, uint8_t uiType, uint16_t uiFrame);
+
+/*!
+Read the raw state of all rows of the keyboard ("1" = key pressed). If no key
+is pressed at all, the function returns after a single read of port 0x00FE.
+@param pRows Buffer for the state of the rows
+@return "0" = no key pressed; "1" = at least one key pressed
+*/
+uint8_t kbd_scan_fastcall(kbdrows_t* pRows) __z88dk_fastcall;
+#define kbd_scan(x) kbd_scan_fastcall(x)
+
+/*!
+Scan the keyboard and add all changes of the keys to the event queue.
+@param pState Pointer to device-structure
+@param uiFrame Timestamp of the events
+*/
+void kbd_update(kbdstate_t* pState, uint16_t uiFrame);
+
+/*!
+Compare the raw state of the keyboard ("tRows") with the previous state and add
+all changes of the keys to the event queue (i.e. after a scan or a replay).
+@param pState Pointer to device-structure
+@param uiFrame Timestamp of the events
+*/
+void kbd_apply(kbdstate_t* pState, uint16_t uiFrame);
+
+/*!
+Translate a key event into a character and update the state of the modifiers
+and the autorepeat.
+@param pState Pointer to device-structure
+@param pEvent Key event
+@return Character; "0" = no character
+*/
+uint8_t kbd_translate(kbdstate_t* pState, const kbdevent_t* pEvent);
+
+/*!
+Current timestamp of a keyboard (frame counter or number of "kbd_isr()" calls
+in background mode).
+@param pState Pointer to device-structure
+@return Current timestamp
+*/
+uint16_t kbd_now(kbdstate_t* pState) __z88dk_fastcall;
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __KBD_INTERNAL_H__ */
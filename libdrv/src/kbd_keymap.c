@@ -0,0 +1,122 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: kbd_keymap.c                                                       |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for the keyboard                                                      |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include "libkbd.h"
+#include "kbd_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+/*!
+Default keymap (ZX Spectrum Next layout): index of a key = row * 5 + bit. The
+SYMBOL SHIFT layer contains the symbols of the extended mode for keys, that
+deliver keywords in the ROM (i.e. "~", "|", "{", "}", "[", "]").
+*/
+const uint8_t g_acKbdKeymap[uiMAX_KBDKEYMAP] =
+{
+  /* unshifted */
+  0x00, 'z', 'x', 'c', 'v', /* CS Z X C V */
+  'a', 's', 'd', 'f', 'g', /* A S D F G */
+  'q', 'w', 'e', 'r', 't', /* Q W E R T */
+  '1', '2', '3', '4', '5', /* 1 2 3 4 5 */
+  '0', '9', '8', '7', '6', /* 0 9 8 7 6 */
+  'p', 'o', 'i', 'u', 'y', /* P O I U Y */
+  KBD_KEY_ENTER, 'l', 'k', 'j', 'h', /* ENT L K J H */
+  ' ', 0x00, 'm', 'n', 'b', /* SPC SS M N B */
+
+  /* CAPS SHIFT */
+  0x00, 'Z', 'X', 'C', 'V', /* CS Z X C V */
+  'A', 'S', 'D', 'F', 'G', /* A S D F G */
+  'Q', 'W', 'E', 'R', 'T', /* Q W E R T */
+  KBD_KEY_EDIT, KBD_KEY_CAPSLOCK, KBD_KEY_TRUEVIDEO, KBD_KEY_INVVIDEO, KBD_KEY_LEFT, /* 1 2 3 4 5 */
+  KBD_KEY_DELETE, KBD_KEY_GRAPH, KBD_KEY_RIGHT, KBD_KEY_UP, KBD_KEY_DOWN, /* 0 9 8 7 6 */
+  'P', 'O', 'I', 'U', 'Y', /* P O I U Y */
+  KBD_KEY_ENTER, 'L', 'K', 'J', 'H', /* ENT L K J H */
+  KBD_KEY_BREAK, 0x00, 'M', 'N', 'B', /* SPC SS M N B */
+
+  /* SYMBOL SHIFT */
+  0x00, ':', 0x60, '?', '/', /* CS Z X C V */
+  '~', '|', '\\', '{', '}', /* A S D F G */
+  0x00, 0x00, 0x00, '<', '>', /* Q W E R T */
+  '!', '@', '#', '$', '%', /* 1 2 3 4 5 */
+  '_', ')', '(', '\'', '&', /* 0 9 8 7 6 */
+  '"', ';', 0x7F, ']', '[', /* P O I U Y */
+  KBD_KEY_ENTER, '=', '+', '-', '^', /* ENT L K J H */
+  ' ', 0x00, '.', ',', '*' /* SPC SS M N B */
+};
+
+/*!
+Characters of the extended keys of the Next keyboard
+*/
+const uint8_t g_acKbdExtKeymap[16] =
+{
+  /* next-reg 0xB0: BIT0 .. BIT7 */
+  KBD_KEY_RIGHT, KBD_KEY_LEFT, KBD_KEY_DOWN, KBD_KEY_UP, '.', ',', '"', ';',
+
+  /* next-reg 0xB1: BIT0 .. BIT7 */
+  KBD_KEY_EXTEND, KBD_KEY_CAPSLOCK, KBD_KEY_GRAPH, KBD_KEY_TRUEVIDEO, KBD_KEY_INVVIDEO, KBD_KEY_BREAK, KBD_KEY_EDIT, KBD_KEY_DELETE
+};
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,113 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: kbd_match.c                                                        |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for the keyboard                                                      |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include "libkbd.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* kbd_match()                                                                */
+/*----------------------------------------------------------------------------*/
+uint8_t kbd_match(kbdstate_t* pState, const kbdset_t* pSet)
+{
+  uint8_t uiResult = 0;
+
+  if (pState && pSet)
+  {
+    register uint8_t uiMask;
+    register uint8_t uiKeys;
+    uint8_t uiBit = 0x01;
+
+    for (uint8_t i = 0; (i < uiMAX_KBDROWS) && uiBit; ++i)
+    {
+      uiMask = pSet->uiRaw8[i];
+      uiKeys = pState->tRows.uiRaw8[i];
+
+      /* gather the keys of the set in this row into consecutive bits */
+      while (uiMask)
+      {
+        if (uiMask & 0x01)
+        {
+          if (uiKeys & 0x01)
+          {
+            uiResult |= uiBit;
+          }
+
+          uiBit <<= 1;
+        }
+
+        uiMask >>= 1;
+        uiKeys >>= 1;
+      }
+    }
+  }
+
+  return uiResult;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -76,8 +76,11 @@ uint8_t kbd_open(kbdstate_t* pState, uint8_t uiIndex)
 {
   if (pState)
   {
-    memset(pState, 0, sizeof(pState));
+    memset(pState, 0, sizeof(kbdstate_t));
     pState->uiIndex = uiIndex;
+    pState->tPriv.pKeymap = g_acKbdKeymap;
+    pState->tPriv.uiRepeatDelay = KBD_REPEAT_DELAY;
+    pState->tPriv.uiRepeatRate  = KBD_REPEAT_RATE;
     return EOK;
   }
 
@@ -0,0 +1,46 @@
+SECTION code_user
+PUBLIC _kbd_scan_fastcall
+
+KBD_ROWS  equ 8
+KBD_KEYS  equ $1F     ; D0 .. D4 of a half row
+
+; ==============================================================================
+; uint8_t kbd_scan_fastcall(kbdrows_t* pRows)
+; ------------------------------------------------------------------------------
+; reads the raw state of all 8 half rows of the keyboard (pressed key = "1")
+; ------------------------------------------------------------------------------
+; Port 0x00FE (A8 .. A15 = 0) delivers all half rows at once: if no key is
+; pressed, the rows are cleared and the function returns immediately.
+; Otherwise the half rows are read with "IN A,(C)" while the "0" in B is
+; rotated from A8 to A15.
+; first (single) argument in (DEH)L (__z88dk_fastcall)
+; return: L = "0": no key pressed; L = "1": at least one key pressed
+; ==============================================================================
+_kbd_scan_fastcall:
+  ld bc, $00FE
+  in a, (c)       ; all half rows
+  cpl
+  and KBD_KEYS
+  jr nz, scan
+
+  ld b, KBD_ROWS  ; no key pressed: A = 0
+clear:
+  ld (hl), a
+  inc hl
+  djnz clear
+  ld l, a
+  ret
+
+scan:
+  ld b, $FE       ; A8 = 0: first half row
+scan_row:
+  in a, (c)
+  cpl
+  and KBD_KEYS
+  ld (hl), a
+  inc hl
+  rlc b           ; carry = "0" after A15
+  jr c, scan_row
+
+  ld l, 1
+  ret
@@ -0,0 +1,105 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: kbd_set_extended.c                                                 |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for the keyboard                                                      |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include "libkbd.h"
+#include "kbd_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* kbd_set_extended()                                                         */
+/*----------------------------------------------------------------------------*/
+uint8_t kbd_set_extended(kbdstate_t* pState, bool bEnable)
+{
+  if (pState)
+  {
+    register uint8_t uiScratch = ZXN_READ_REG(KBD_REG_ULA_CONTROL);
+
+    if (bEnable)
+    {
+      pState->tPriv.uiFlags |= KBD_FLAG_EXTENDED;
+      pState->tPriv.uiExtKeys[0] = ZXN_READ_REG(KBD_REG_EXTKEYS0);
+      pState->tPriv.uiExtKeys[1] = ZXN_READ_REG(KBD_REG_EXTKEYS1);
+      ZXN_WRITE_REG(KBD_REG_ULA_CONTROL, uiScratch | KBD_ULA_CANCEL_EXTKEYS);
+    }
+    else if (pState->tPriv.uiFlags & KBD_FLAG_EXTENDED)
+    {
+      pState->tPriv.uiFlags &= ~KBD_FLAG_EXTENDED;
+      ZXN_WRITE_REG(KBD_REG_ULA_CONTROL, uiScratch & ~KBD_ULA_CANCEL_EXTKEYS);
+    }
+
+    return EOK;
+  }
+
+  return EINVAL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,178 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: kbd_translate.c                                                    |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for the keyboard                                                      |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include "libkbd.h"
+#include "kbd_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* kbd_translate()                                                            */
+/*----------------------------------------------------------------------------*/
+uint8_t kbd_translate(kbdstate_t* pState, const kbdevent_t* pEvent)
+{
+  register uint8_t uiIndex;
+  register uint8_t uiKey;
+  uint8_t uiChar;
+
+  /* modifiers */
+  if ((KBD_SCANCODE_CPS == pEvent->uiScanCode) || (KBD_SCANCODE_SYM == pEvent->uiScanCode))
+  {
+    uiKey = (KBD_SCANCODE_CPS == pEvent->uiScanCode) ? KBD_FLAG_CAPS : KBD_FLAG_SYMBOL;
+
+    if (KBD_EVENT_DOWN == pEvent->uiType)
+    {
+      pState->tPriv.uiFlags |= uiKey;
+
+      if ((pState->tPriv.uiFlags & (KBD_FLAG_CAPS | KBD_FLAG_SYMBOL)) == (KBD_FLAG_CAPS | KBD_FLAG_SYMBOL))
+      {
+        return KBD_KEY_EXTEND;
+      }
+    }
+    else
+    {
+      pState->tPriv.uiFlags &= ~uiKey;
+    }
+
+    return 0;
+  }
+
+  if (KBD_EVENT_DOWN != pEvent->uiType)
+  {
+    if (pEvent->uiScanCode == pState->tPriv.uiRepeatCode)
+    {
+      pState->tPriv.uiRepeatChar = 0;
+    }
+
+    return 0;
+  }
+
+  /* index of the key: row * 5 + bit */
+  uiIndex = (pEvent->uiScanCode >> 8) * 5;
+
+  for (uiKey = pEvent->uiScanCode & 0xFF; uiKey > 1; uiKey >>= 1)
+  {
+    ++uiIndex;
+  }
+
+  /* modifiers pressed in the same scan are queued later (row 7 for SYMBOL SHIFT) */
+  uiKey = pState->tPriv.uiFlags;
+
+  for (uint8_t i = pState->tPriv.uiTail; i != pState->tPriv.uiHead; i = (i + 1) & (uiMAX_KBDEVENTS - 1))
+  {
+    if (pState->tPriv.tEvent[i].uiFrame != pEvent->uiFrame)
+    {
+      break;
+    }
+
+    if (KBD_EVENT_DOWN == pState->tPriv.tEvent[i].uiType)
+    {
+      if (KBD_SCANCODE_CPS == pState->tPriv.tEvent[i].uiScanCode)
+      {
+        uiKey |= KBD_FLAG_CAPS;
+      }
+      else if (KBD_SCANCODE_SYM == pState->tPriv.tEvent[i].uiScanCode)
+      {
+        uiKey |= KBD_FLAG_SYMBOL;
+      }
+    }
+  }
+
+  if (uiKey & KBD_FLAG_SYMBOL)
+  {
+    uiIndex += 2 * uiMAX_KBDKEYS;
+  }
+  else if (uiKey & KBD_FLAG_CAPS)
+  {
+    uiIndex += uiMAX_KBDKEYS;
+  }
+
+  uiChar = pState->tPriv.pKeymap[uiIndex];
+
+  if (KBD_KEY_CAPSLOCK == uiChar)
+  {
+    pState->tPriv.uiFlags ^= KBD_FLAG_CAPSLOCK;
+    return 0;
+  }
+
+  if ((pState->tPriv.uiFlags & KBD_FLAG_CAPSLOCK) && ('a' <= uiChar) && ('z' >= uiChar))
+  {
+    uiChar -= 'a' - 'A';
+  }
+
+  if (uiChar)
+  {
+    pState->tPriv.uiRepeatChar = uiChar;
+    pState->tPriv.uiRepeatCode = pEvent->uiScanCode;
+    pState->tPriv.uiRepeatNext = pEvent->uiFrame + pState->tPriv.uiRepeatDelay;
+  }
+
+  return uiChar;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
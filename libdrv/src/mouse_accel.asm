@@ -0,0 +1,84 @@
+SECTION code_user
+PUBLIC _mouse_accel_callee
+
+CURVE_LAST  equ 15    ; index of the last entry of an acceleration curve
+
+; ==============================================================================
+; int16_t mouse_accel_callee(const uint8_t* pCurve,
+;                            uint8_t* pFrac,
+;                            int8_t iDelta)
+; ------------------------------------------------------------------------------
+; scales the movement of one sample by an acceleration curve and accumulates it
+; with a resolution of 1/256 pixel
+; ------------------------------------------------------------------------------
+; The gain (4.4 fixed-point, 0x10 = 1.0) is taken from "pCurve[min(|iDelta|,
+; 15)]"; the step "|iDelta| * gain" is computed with "MUL D,E" in 1/16 pixel.
+; Its fractional part is added to (or subtracted from) the fraction "*pFrac" of
+; the 8.8 position, the whole pixels (incl. the carry) are returned.
+; return: HL = signed movement in pixels
+; ==============================================================================
+_mouse_accel_callee:
+  pop hl          ; return address
+  pop de          ; DE = pCurve
+  pop bc          ; BC = pFrac
+  dec sp
+  ex (sp), hl     ; H = iDelta; return address back on the stack
+
+  ld a, h
+  or a
+  jr z, accel_zero
+
+  push bc         ; [pFrac]
+  ld c, a         ; C = iDelta (sign)
+  jp p, accel_abs
+  neg
+
+accel_abs:
+  ld h, a         ; H = |iDelta|
+  cp CURVE_LAST
+  jr c, accel_gain
+  ld a, CURVE_LAST
+
+accel_gain:
+  add de, a
+  ld a, (de)
+  ld e, a         ; E = gain
+  ld d, h
+  mul d, e        ; DE = step = |iDelta| * gain (1/16 pixel)
+
+  ld a, e
+  add a, a
+  add a, a
+  add a, a
+  add a, a        ; A = fraction of the step (1/256 pixel)
+  ld b, 4
+  bsrl de, b      ; DE = whole pixels of the step
+
+  pop hl          ; HL = pFrac
+  bit 7, c
+  jr nz, accel_neg
+
+  add a, (hl)     ; fraction += step
+  ld (hl), a
+  jr nc, accel_pos
+  inc de          ; carry into the pixels
+accel_pos:
+  ex de, hl       ; HL = +pixels
+  ret
+
+accel_neg:
+  ld b, a
+  ld a, (hl)
+  sub b           ; fraction -= step
+  ld (hl), a
+  jr nc, accel_sub
+  inc de          ; borrow from the pixels
+accel_sub:
+  ld hl, 0
+  or a
+  sbc hl, de      ; HL = -pixels
+  ret
+
+accel_zero:
+  ld hl, 0
+  ret
@@ -0,0 +1,104 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: mouse_apply.c                                                      |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for mouse-/trackball-devices                                          |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include "libdrv.h"
+#include "mouse_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* mouse_apply()                                                              */
+/*----------------------------------------------------------------------------*/
+void mouse_apply(mousestate_t* pState, uint8_t uiValue, uint16_t uiFrame)
+{
+  register uint8_t uiChanged;
+
+  uiChanged = (uiValue ^ pState->tPriv.uiBtn) & 0x07;  /* MAME sets BIT3 ?! */
+
+  for (uint8_t uiBtn = MOUSE_BTN_RIGHT; uiChanged; uiBtn <<= 1)
+  {
+    if (uiChanged & uiBtn)
+    {
+      mouse_put_event(pState, (uiValue & uiBtn) ? MOUSE_EVENT_DOWN : MOUSE_EVENT_UP, uiBtn, uiFrame);
+      uiChanged &= ~uiBtn;
+    }
+  }
+
+  pState->tPriv.uiBtn = uiValue & 0x07;
+
+  uiValue >>= 4;
+  uiChanged = (uiValue - pState->tPriv.uiWhl) & 0x0F; /* 4 bit, wraps */
+
+  if (uiChanged)
+  {
+    mouse_put_event(pState, MOUSE_EVENT_WHEEL, (uiChanged & 0x08) ? (uiChanged | 0xF0) : uiChanged, uiFrame);
+    pState->tPriv.uiWhl = uiValue;
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
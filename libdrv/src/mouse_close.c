@@ -76,6 +76,7 @@ uint8_t mouse_close(mousestate_t* pState)
 {
   if (pState)
   {
+    mouse_set_background(pState, false);
     pState->uiIndex = 0xFF;
     return EOK;
   }
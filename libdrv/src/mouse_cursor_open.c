@@ -0,0 +1,117 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: mouse_cursor_open.c                                                |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for mouse-/trackball-devices                                          |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <string.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include "libdrv.h"
+#include "mouse_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+__sfr __banked __at MOUSE_PORT_SPRITE_SLOT IO_MOUSE_SPRITE_SLOT;
+__sfr __at MOUSE_PORT_SPRITE_PATTERN IO_MOUSE_SPRITE_PATTERN;
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* mouse_cursor_open()                                                        */
+/*----------------------------------------------------------------------------*/
+uint8_t mouse_cursor_open(mousecursor_t* pCursor, uint8_t uiSprite, uint8_t uiPattern, const uint8_t* pPattern)
+{
+  if (pCursor && pPattern && (128 > uiSprite) && (64 > uiPattern))
+  {
+    memset(pCursor, 0, sizeof(mousecursor_t));
+    pCursor->uiSprite  = uiSprite;
+    pCursor->uiPattern = uiPattern;
+    pCursor->uiLayer   = MOUSE_LAYER_256x192;
+
+    /* Upload the pattern (auto-increment) */
+    IO_MOUSE_SPRITE_SLOT = uiPattern;
+
+    for (uint16_t i = 0; i < MOUSE_CURSOR_PATTERN_SIZE; ++i)
+    {
+      IO_MOUSE_SPRITE_PATTERN = pPattern[i];
+    }
+
+    /* Hide the sprite until the first update */
+    pCursor->tPriv.uiAttr[3] = MOUSE_ATTR3_ATTR4 | uiPattern;
+
+    ZXN_WRITE_REG(MOUSE_REG_SPRITE_NUMBER, uiSprite);
+
+    for (uint8_t i = 0; i < sizeof(pCursor->tPriv.uiAttr); ++i)
+    {
+      ZXN_WRITE_REG(MOUSE_REG_SPRITE_ATTR0 + i, pCursor->tPriv.uiAttr[i]);
+    }
+
+    ZXN_WRITE_REG(MOUSE_REG_SPRITE_SYSTEM, ZXN_READ_REG(MOUSE_REG_SPRITE_SYSTEM) | MOUSE_SPRITES_VISIBLE);
+
+    return EOK;
+  }
+
+  return EINVAL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
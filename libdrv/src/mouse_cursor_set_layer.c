@@ -0,0 +1,99 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: mouse_cursor_set_layer.c                                           |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for mouse-/trackball-devices                                          |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <errno.h>
+#include "libdrv.h"
+#include "mouse_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+/*!
+Geometry of the layers: the sprite area is 320 x 256 pixels; the 256 x 192
+display starts at 32, 32
+*/
+const mouselayer_t g_tMouseLayer[MOUSE_LAYERS] =
+{
+  { 256, 192, 32, 32, 0 },  /* MOUSE_LAYER_256x192 */
+  { 320, 256,  0,  0, 0 },  /* MOUSE_LAYER_320x256 */
+  { 640, 256,  0,  0, 1 }   /* MOUSE_LAYER_640x256 */
+};
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* mouse_cursor_set_layer()                                                   */
+/*----------------------------------------------------------------------------*/
+uint8_t mouse_cursor_set_layer(mousecursor_t* pCursor, uint8_t uiLayer)
+{
+  if (pCursor && (MOUSE_LAYERS > uiLayer))
+  {
+    pCursor->uiLayer = uiLayer;
+    return EOK;
+  }
+
+  return EINVAL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,126 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: mouse_cursor_update.c                                              |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for mouse-/trackball-devices                                          |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include "libdrv.h"
+#include "mouse_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* mouse_cursor_update()                                                      */
+/*----------------------------------------------------------------------------*/
+uint8_t mouse_cursor_update(mousecursor_t* pCursor, const mousestate_t* pMouse)
+{
+  if (pCursor && pMouse)
+  {
+    const mouselayer_t* pLayer = &g_tMouseLayer[pCursor->uiLayer];
+    uint8_t uiAttr[5];
+    int16_t iX = pMouse->iX;
+    int16_t iY = pMouse->iY;
+    bool bSelected = false;
+
+    /* Clip to the layer (y = 0: bottom line) */
+    iX = (0 > iX) ? 0 : ((int16_t) pLayer->uiWidth  <= iX ? pLayer->uiWidth  - 1 : iX);
+    iY = (0 > iY) ? 0 : ((int16_t) pLayer->uiHeight <= iY ? pLayer->uiHeight - 1 : iY);
+
+    /* Sprite coordinates of the top left corner of the pattern: negative values
+       wrap (9 bit), so the pattern is partly off-screen at the left/top edge */
+    iX = (pLayer->uiOriginX + (iX >> pLayer->uiShiftX) - pCursor->uiHotX) & 0x01FF;
+    iY = (pLayer->uiOriginY + (pLayer->uiHeight - 1 - iY) - pCursor->uiHotY) & 0x01FF;
+
+    uiAttr[0] = (uint8_t) iX;
+    uiAttr[1] = (uint8_t) iY;
+    uiAttr[2] = (uint8_t) (iX >> 8) & 0x01;
+    uiAttr[3] = MOUSE_ATTR3_VISIBLE | MOUSE_ATTR3_ATTR4 | pCursor->uiPattern;
+    uiAttr[4] = (uint8_t) (iY >> 8) & 0x01;
+
+    /* Write the changed attributes only */
+    for (uint8_t i = 0; i < sizeof(uiAttr); ++i)
+    {
+      if (uiAttr[i] != pCursor->tPriv.uiAttr[i])
+      {
+        if (!bSelected)
+        {
+          ZXN_WRITE_REG(MOUSE_REG_SPRITE_NUMBER, pCursor->uiSprite);
+          bSelected = true;
+        }
+
+        ZXN_WRITE_REG(MOUSE_REG_SPRITE_ATTR0 + i, uiAttr[i]);
+        pCursor->tPriv.uiAttr[i] = uiAttr[i];
+      }
+    }
+
+    return EOK;
+  }
+
+  return EINVAL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
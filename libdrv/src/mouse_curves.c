@@ -0,0 +1,99 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: mouse_curves.c                                                     |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for mouse-/trackball-devices                                          |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include "libdrv.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+/*!
+Linear: gain 1.0 for all speeds (i.e. to use the clamping only)
+*/
+const uint8_t g_acMouseCurveLinear[MOUSE_CURVE_SIZE] =
+{
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10
+};
+
+/*!
+Mild: gain 1.0 up to 2 counts per sample, rising to 2.0 at 10 counts
+*/
+const uint8_t g_acMouseCurveMild[MOUSE_CURVE_SIZE] =
+{
+  0x10, 0x10, 0x10, 0x12, 0x14, 0x16, 0x18, 0x1A,
+  0x1C, 0x1E, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20
+};
+
+/*!
+Fast: gain 0.75 at 1 .. 2 counts per sample (precise positioning), rising to
+3.0 at 11 counts
+*/
+const uint8_t g_acMouseCurveFast[MOUSE_CURVE_SIZE] =
+{
+  0x10, 0x0C, 0x0C, 0x10, 0x14, 0x18, 0x1C, 0x20,
+  0x24, 0x28, 0x2C, 0x30, 0x30, 0x30, 0x30, 0x30
+};
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
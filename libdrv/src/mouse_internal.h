@@ -0,0 +1,178 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: mouse_internal.h                                                   |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for mouse-/trackball-devices                                          |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__MOUSE_INTERNAL_H__)
+  #define __MOUSE_INTERNAL_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include "libdrv.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+/*!
+Next-reg "sprite and layers system"; BIT0 = sprites visible
+*/
+#define MOUSE_REG_SPRITE_SYSTEM (0x15)
+#define MOUSE_SPRITES_VISIBLE   (0x01)
+
+/*!
+Next-reg to select a sprite; next-regs of the attributes 0 .. 4 of this sprite
+*/
+#define MOUSE_REG_SPRITE_NUMBER (0x34)
+#define MOUSE_REG_SPRITE_ATTR0  (0x35)
+
+/*!
+Bits of the sprite attribute 3
+*/
+#define MOUSE_ATTR3_VISIBLE (0x80)
+#define MOUSE_ATTR3_ATTR4   (0x40)  /* 5 byte attributes (9 bit Y) */
+
+/*!
+Port to select the pattern slot and port to upload the pattern
+*/
+#define MOUSE_PORT_SPRITE_SLOT    (0x303B)
+#define MOUSE_PORT_SPRITE_PATTERN (0x5B)
+
+/*!
+Number of layers of the mouse cursor ("MOUSE_LAYER_...")
+*/
+#define MOUSE_LAYERS (3)
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+/*!
+Mouse, that is sampled in the background by "mouse_isr()"
+*/
+extern mousestate_t* g_pMouseIsr;
+
+/*!
+"1" = background sampling by "mouse_isr()" is active
+*/
+extern volatile uint8_t g_uiMouseIsrActive;
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+/*!
+Geometry of a layer in the coordinates of the sprites
+*/
+typedef struct _mouselayer
+{
+  /*!
+  Size of the layer in pixels
+  */
+  uint16_t uiWidth;
+  uint16_t uiHeight;
+
+  /*!
+  Position of the top left corner of the layer in sprite coordinates
+  */
+  uint8_t uiOriginX;
+  uint8_t uiOriginY;
+
+  /*!
+  Horizontal pixels of the layer per sprite pixel (as shift: 0 = 1, 1 = 2)
+  */
+  uint8_t uiShiftX;
+} mouselayer_t;
+
+/*!
+Geometry of the layers of the mouse cursor ("MOUSE_LAYER_...")
+*/
+extern const mouselayer_t g_tMouseLayer[MOUSE_LAYERS];
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+/*!
+Sample the kempston mouse: the movement is added to "tPriv.iAccX"/"tPriv.iAccY",
+changes of the buttons and the scroll wheel are added to the event queue.
+@param pState Pointer to device-structure
+@param uiFrame Timestamp of the events
+*/
+void mouse_update(mousestate_t* pState, uint16_t uiFrame);
+
+/*!
+Take over the state of the buttons and the scroll wheel; changes are added to
+the event queue (i.e. after a sample or a replay).
+@param pState Pointer to device-structure
+@param uiValue Buttons (BIT2:0) and scroll wheel (BIT7:4), "1" = pressed
+@param uiFrame Timestamp of the events
+*/
+void mouse_apply(mousestate_t* pState, uint8_t uiValue, uint16_t uiFrame);
+
+/*!
+Add an event to the event queue of a mouse. If the queue is full, the event is
+dropped and counted as lost.
+@param pState Pointer to device-structure
+@param uiType Type of the event (i.e. "MOUSE_EVENT_DOWN")
+@param uiData Button or steps of the scroll wheel
+@param uiFrame Timestamp of the event in frames
+*/
+void mouse_put_event(mousestate_t* pState, uint8_t uiType, uint8_t uiData, uint16_t uiFrame);
+
+/*!
+Scale the movement of one sample by an acceleration curve and accumulate it
+with a resolution of 1/256 pixel.
+@param pCurve Acceleration curve ("MOUSE_CURVE_SIZE" gains, 4.4 fixed-point)
+@param pFrac Fractional part of the position
+@param iDelta Movement of the sample
+@return Movement in pixels
+*/
+int16_t mouse_accel_callee(const uint8_t* pCurve, uint8_t* pFrac, int8_t iDelta) __z88dk_callee;
+#define mouse_accel(x, y, z) mouse_accel_callee(x, y, z)
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __MOUSE_INTERNAL_H__ */
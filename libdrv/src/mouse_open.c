@@ -41,6 +41,7 @@
 #include <errno.h>
 #include "libzxn.h"
 #include "libdrv.h"
+#include "mouse_internal.h"
 
 /*============================================================================*/
 /*                               Macros                                       */
@@ -77,8 +78,14 @@ uint8_t mouse_open(mousestate_t* pState, uint8_t uiIndex)
 {
   if (pState)
   {
-    memset(pState, 0, sizeof(pState));
+    memset(pState, 0, sizeof(mousestate_t));
     pState->uiIndex = uiIndex;
+
+    /* take the current counters as reference; no events for held buttons */
+    mouse_update(pState, 0);
+    pState->tPriv.iAccX = 0;
+    pState->tPriv.iAccY = 0;
+    pState->tPriv.uiHead = pState->tPriv.uiTail;
     return EOK;
   }
 
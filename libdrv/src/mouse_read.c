@@ -37,8 +37,13 @@
 /*                               Includes                                     */
 /*============================================================================*/
 #include <stdint.h>
+#include <stdbool.h>
 #include <errno.h>
+#include <intrinsic.h>
+#include <z80.h>
+#include "libzxn.h"
 #include "libdrv.h"
+#include "mouse_internal.h"
 
 /*============================================================================*/
 /*                               Macros                                       */
@@ -51,9 +56,6 @@
 /*============================================================================*/
 /*                               Variables                                    */
 /*============================================================================*/
-__sfr __banked __at 0xFBDF IO_KMOUSE_X;
-__sfr __banked __at 0xFFDF IO_KMOUSE_Y;
-__sfr __banked __at 0xFADF IO_KMOUSE_BTN;
 
 /*============================================================================*/
 /*                               Structures                                   */
@@ -66,13 +68,6 @@ __sfr __banked __at 0xFADF IO_KMOUSE_BTN;
 /*============================================================================*/
 /*                               Prototypes                                   */
 /*============================================================================*/
-/*!
-Function to compute the signed difference between two unsigned values
-@param uiCurr Current value
-@param uiPrev Previous value
-@return Signed delta of both values
-*/
-static int8_t mouse_delta(uint8_t uiCurr, uint8_t uiPrev) __z88dk_callee;
 
 /*============================================================================*/
 /*                               Implementation                               */
@@ -105,20 +100,55 @@ uint8_t mouse_read(mousestate_t* pState) __z88dk_fastcall
 
   if (pState)
   {
-    /* Update buttons and wheel */
-    pState->tPriv.uiCurrX = ~IO_KMOUSE_BTN;
-    pState->uiBtn = pState->tPriv.uiCurrX & 0x07; /* MAME sets BIT3 ?!*/
-    pState->uiWhl = pState->tPriv.uiCurrX >> 4;   /* MAME sets constant 0x7 */
-
-    /* Update position */
-    pState->tPriv.uiCurrX = IO_KMOUSE_X;
-    pState->tPriv.uiCurrY = IO_KMOUSE_Y;
-
-    pState->iX += mouse_delta(pState->tPriv.uiCurrX, pState->tPriv.uiPrevX);   // right = +
-    pState->iY += mouse_delta(pState->tPriv.uiCurrY, pState->tPriv.uiPrevY);   // up    = +
-
-    pState->tPriv.uiPrevX = pState->tPriv.uiCurrX;
-    pState->tPriv.uiPrevY = pState->tPriv.uiCurrY;
+    const bool bBackground = g_uiMouseIsrActive && (g_pMouseIsr == pState);
+    uint16_t uiState = 0;
+
+    if (bBackground)
+    {
+      uiState = z80_get_int_state();
+      intrinsic_di();  /* sampled by "mouse_isr()": fetch atomically */
+    }
+    else
+    {
+      mouse_update(pState, (uint16_t) zxn_frames());
+    }
+
+    pState->iX += pState->tPriv.iAccX;
+    pState->iY += pState->tPriv.iAccY;
+    pState->tPriv.iAccX = 0;
+    pState->tPriv.iAccY = 0;
+    pState->uiBtn = pState->tPriv.uiBtn;
+    pState->uiWhl = pState->tPriv.uiWhl;
+
+    if (pState->tPriv.uiClamp)
+    {
+      if (pState->iX < pState->tPriv.iMinX)
+      {
+        pState->iX = pState->tPriv.iMinX;
+        pState->tPriv.uiFracX = 0x00;
+      }
+      else if (pState->iX > pState->tPriv.iMaxX)
+      {
+        pState->iX = pState->tPriv.iMaxX;
+        pState->tPriv.uiFracX = 0xFF;
+      }
+
+      if (pState->iY < pState->tPriv.iMinY)
+      {
+        pState->iY = pState->tPriv.iMinY;
+        pState->tPriv.uiFracY = 0x00;
+      }
+      else if (pState->iY > pState->tPriv.iMaxY)
+      {
+        pState->iY = pState->tPriv.iMaxY;
+        pState->tPriv.uiFracY = 0xFF;
+      }
+    }
+
+    if (bBackground)
+    {
+      z80_set_int_state(uiState);  /* the caller may run with DI (ISR) */
+    }
 
     return EOK;
   }
@@ -127,16 +157,6 @@ uint8_t mouse_read(mousestate_t* pState) __z88dk_fastcall
 }
 
 
-/*----------------------------------------------------------------------------*/
-/* mouse_delta()                                                              */
-/*----------------------------------------------------------------------------*/
-static int8_t mouse_delta(uint8_t uiCurr, uint8_t uiPrev) __z88dk_callee
-{
-  register uint8_t uiDelta = (uint8_t) (uiCurr - uiPrev);   // modulo 256
-  return (uiDelta >= 128) ? (int8_t) (uiDelta - 256) : (int8_t) uiDelta;
-}
-
-
 /*----------------------------------------------------------------------------*/
 /*                                                                            */
 /*----------------------------------------------------------------------------*/
@@ -0,0 +1,120 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: mouse_update.c                                                     |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for mouse-/trackball-devices                                          |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include "libdrv.h"
+#include "mouse_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+__sfr __banked __at 0xFBDF IO_KMOUSE_X;
+__sfr __banked __at 0xFFDF IO_KMOUSE_Y;
+__sfr __banked __at 0xFADF IO_KMOUSE_BTN;
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+/*!
+Function to compute the signed difference between two unsigned values
+@param uiCurr Current value
+@param uiPrev Previous value
+@return Signed delta of both values
+*/
+static int8_t mouse_delta(uint8_t uiCurr, uint8_t uiPrev) __z88dk_callee;
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* mouse_update()                                                             */
+/*----------------------------------------------------------------------------*/
+void mouse_update(mousestate_t* pState, uint16_t uiFrame)
+{
+  /* Buttons and scroll wheel */
+  mouse_apply(pState, ~IO_KMOUSE_BTN, uiFrame);
+
+  /* Position: the signed 8-bit deltas of a single frame can't wrap */
+  pState->tPriv.uiCurrX = IO_KMOUSE_X;
+  pState->tPriv.uiCurrY = IO_KMOUSE_Y;
+
+  if (pState->tPriv.pCurve)
+  {
+    pState->tPriv.iAccX += mouse_accel(pState->tPriv.pCurve, &pState->tPriv.uiFracX, mouse_delta(pState->tPriv.uiCurrX, pState->tPriv.uiPrevX));
+    pState->tPriv.iAccY += mouse_accel(pState->tPriv.pCurve, &pState->tPriv.uiFracY, mouse_delta(pState->tPriv.uiCurrY, pState->tPriv.uiPrevY));
+  }
+  else
+  {
+    pState->tPriv.iAccX += mouse_delta(pState->tPriv.uiCurrX, pState->tPriv.uiPrevX);   // right = +
+    pState->tPriv.iAccY += mouse_delta(pState->tPriv.uiCurrY, pState->tPriv.uiPrevY);   // up    = +
+  }
+
+  pState->tPriv.uiPrevX = pState->tPriv.uiCurrX;
+  pState->tPriv.uiPrevY = pState->tPriv.uiCurrY;
+}
+
+/*----------------------------------------------------------------------------*/
+/* mouse_delta()                                                              */
+/*----------------------------------------------------------------------------*/
+static int8_t mouse_delta(uint8_t uiCurr, uint8_t uiPrev) __z88dk_callee
+{
+  register uint8_t uiDelta = (uint8_t) (uiCurr - uiPrev);   // modulo 256
+  return (uiDelta >= 128) ? (int8_t) (uiDelta - 256) : (int8_t) uiDelta;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -43,6 +43,15 @@
 /*============================================================================*/
 /*                               Macros                                       */
 /*============================================================================*/
+/*!
+Factor to convert milliseconds into periods of the envelope generator:
+PSG_CLOCK * ms / (256 * 1000) = (PSG_CLOCK / 2000) * ms / 128
+*/
+#define PSG_ENV_MS_FACTOR ((uint32_t) (PSG_CLOCK / 2000))
+
+#if ((PSG_CLOCK % 2000) != 0) || (PSG_PRESCALER_ENV != 256)
+  #error "psg_calc_envelope_period_ms() requires PSG_CLOCK = n * 2000 Hz"
+#endif
 
 /*============================================================================*/
 /*                               Constants                                    */
@@ -55,14 +64,6 @@
 /*============================================================================*/
 /*                               Structures                                   */
 /*============================================================================*/
-static struct _data
-{
-  uint16_t uiSec;
-  uint16_t uiMSec;
-  uint32_t uiNum;
-  uint32_t uiResult_s;
-  uint32_t uiResult_ms;
-} g_tData;
 
 /*============================================================================*/
 /*                               Typ-Definitions                              */
@@ -81,20 +82,16 @@ static struct _data
 /*----------------------------------------------------------------------------*/
 uint16_t psg_calc_envelope_period_ms(uint16_t uiTime /* ms */)
 {
-  g_tData.uiSec  = uiTime / UINT16_C(1000);   // 0 .. 65
-  g_tData.uiMSec = uiTime - (g_tData.uiSec * UINT16_C(1000)); // 0 .. 999
-
-  // Part 1: floor(PSG_CLOCK * s / 256)
-  // PSG_CLOCK * s <= 1773447 * 65 = 115274055 (fits 32-bit)
-  g_tData.uiResult_s = (((uint32_t) PSG_CLOCK) * ((uint32_t) g_tData.uiSec)) / ((uint32_t) PSG_PRESCALER_ENV);
-
-  // Part 2: round(PSG_CLOCK * ms / (256*1000))
-  // PSG_CLOCK * ms <= 1773447 * 999 = 1771673553 (fits 32-bit)
-  const uint32_t uiDENOM = ((uint32_t) PSG_PRESCALER_ENV) * UINT32_C(1000); // 256000
-  g_tData.uiNum       = ((uint32_t) PSG_CLOCK) * ((uint32_t) g_tData.uiMSec);
-  g_tData.uiResult_ms = (g_tData.uiNum + (uiDENOM / 2)) / uiDENOM;         // +128000
+  /* uiTime / 1000 by reciprocal multiplication (exact for 0 .. 65535) */
+  const uint16_t uiSec  = (uint16_t) ((((uint32_t) (uiTime >> 1)) * UINT32_C(33555)) >> 24); // 0 .. 65
+  const uint16_t uiMSec = uiTime - (uiSec * UINT16_C(1000)); // 0 .. 999
 
-  return (uint16_t) (g_tData.uiResult_s + g_tData.uiResult_ms);
+  // Part 1: floor(PSG_CLOCK * s / 256) = s * 6835 + floor(s * 240 / 256)
+  // Part 2: round(PSG_CLOCK * ms / 256000) = floor((ms * 875 + 64) / 128)
+  // The sum is truncated to 16 bit anyway, so part 1 is computed modulo 2^16.
+  return (uiSec * ((uint16_t) (PSG_CLOCK / PSG_PRESCALER_ENV))) +
+         ((uiSec * ((uint16_t) (PSG_CLOCK % PSG_PRESCALER_ENV))) >> 8) +
+         ((uint16_t) ((((uint32_t) uiMSec) * PSG_ENV_MS_FACTOR + UINT32_C(64)) >> 7));
 }
 
 
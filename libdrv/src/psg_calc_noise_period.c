@@ -43,6 +43,9 @@
 /*============================================================================*/
 /*                               Macros                                       */
 /*============================================================================*/
+#if (PSG_PRESCALER_NOISE) != (PSG_PRESCALER_FREQ)
+  #error "psg_calc_noise_period() shares the reciprocals of the tone generators"
+#endif
 
 /*============================================================================*/
 /*                               Constants                                    */
@@ -75,8 +78,8 @@ uint8_t psg_calc_noise_period(uint16_t uiFrequency)
 {
   if (uiFrequency)
   {
-    uint32_t uiFreq = ((uint32_t) (PSG_PRESCALER_NOISE)) * ((uint32_t) uiFrequency);
-    return (((uint32_t) PSG_CLOCK) + (uiFreq >> 1)) / uiFreq;
+    /* round(a / b) = (floor(2 * a / b) + 1) / 2 */
+    return (uint8_t) ((psg_calc_period(uiFrequency, g_uiPsgRecipTone) + 1) >> 1);
   }
 
   return 0;
@@ -0,0 +1,126 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: psg_calc_note_period.c                                             |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for programmable sound generators (AY-3-8912)                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include "libpsg.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+/*!
+Period of a tone with the given frequency in [mHz] (rounded)
+*/
+#define PSG_NOTE_PERIOD(f) ((uint16_t) (((PSG_CLOCK * 1000UL) / (8UL * (f)) + 1) >> 1))
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+/*!
+Periods of the notes of the lowest octave (C1 .. B1); all other octaves are
+derived by shifting
+*/
+static const uint16_t g_uiPsgNotePeriod[12] =
+{
+  PSG_NOTE_PERIOD(32703),  /* C1  */
+  PSG_NOTE_PERIOD(34648),  /* DB1 */
+  PSG_NOTE_PERIOD(36708),  /* D1  */
+  PSG_NOTE_PERIOD(38891),  /* EB1 */
+  PSG_NOTE_PERIOD(41203),  /* E1  */
+  PSG_NOTE_PERIOD(43654),  /* F1  */
+  PSG_NOTE_PERIOD(46249),  /* GB1 */
+  PSG_NOTE_PERIOD(48999),  /* G1  */
+  PSG_NOTE_PERIOD(51913),  /* AB1 */
+  PSG_NOTE_PERIOD(55000),  /* A1  */
+  PSG_NOTE_PERIOD(58270),  /* BB1 */
+  PSG_NOTE_PERIOD(61735)   /* B1  */
+};
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* psg_calc_note_period()                                                     */
+/*----------------------------------------------------------------------------*/
+uint16_t psg_calc_note_period(uint8_t uiNote) __z88dk_fastcall
+{
+  register uint8_t uiOctave = 0;
+  uint16_t uiPeriod;
+
+  /* the table covers 8 octaves: shifts stay within 0 .. 7 */
+  if (PSG_NOTE_MAX < uiNote)
+  {
+    uiNote = PSG_NOTE_MAX;
+  }
+
+  while (12 <= uiNote)
+  {
+    uiNote -= 12;
+    ++uiOctave;
+  }
+
+  uiPeriod = g_uiPsgNotePeriod[uiNote];
+
+  if (uiOctave)
+  {
+    uiPeriod = (uiPeriod + (1 << (uiOctave - 1))) >> uiOctave;
+  }
+
+  return uiPeriod;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,162 @@
+SECTION code_user
+PUBLIC _psg_calc_period_callee
+
+; ==============================================================================
+; uint32_t psg_calc_period_callee(uint16_t uiDivisor, const uint32_t* pRecip)
+; ------------------------------------------------------------------------------
+; calculates "floor(pRecip[0] / uiDivisor)" without any division
+; ------------------------------------------------------------------------------
+; pRecip points to a table of 128 reciprocals "floor(N * 128 / m)" for the
+; normalized divisors m = 128 .. 255 (see psg_calc_recip.c); pRecip[0] is the
+; dividend N itself (N < 2^18). uiDivisor must not be "0".
+;
+; uiDivisor < 256:  the divisor is shifted left into m; the table entry shifted
+;                   right by the index of its msb is the exact quotient
+; uiDivisor >= 256: the divisor is truncated to its upper 8 bits; the table
+;                   entry gives an estimate, that is never too small (max. +4
+;                   for N < 2^18; +3 with g_uiPsgRecipTone, +1 with
+;                   g_uiPsgRecipEnv; checked by tools/psgrender/psgmath.c).
+;                   The remainder is computed with MUL D,E and the estimate is
+;                   corrected by subtraction.
+;
+; No static data is used: the function is reentrant.
+; ==============================================================================
+_psg_calc_period_callee:
+  pop hl
+  pop bc          ; BC = uiDivisor
+  ex (sp),hl      ; HL = pRecip
+
+  ld a, b
+  or a
+  jr nz, hi_path
+
+  ; --- uiDivisor < 256: exact table lookup -----------------------------------
+  ld a, c
+  ld b, 7         ; B = index of msb
+lo_norm:
+  or a
+  jp m, lo_found
+  add a, a
+  dec b
+  jr lo_norm
+
+lo_found:
+  and $7F
+  ld d, a
+  ld e, 4
+  mul d, e        ; DE = (m - 128) * 4
+  add hl, de
+  ld e, (hl)
+  inc hl
+  ld d, (hl)
+  inc hl
+  ld a, (hl)
+  ex de, hl       ; A:HL = pRecip[m - 128]
+
+  inc b
+  dec b
+  jr z, lo_done
+lo_shift:
+  srl a
+  rr h
+  rr l
+  djnz lo_shift
+
+lo_done:
+  ld e, a
+  ld d, 0         ; DEHL = quotient
+  ret
+
+  ; --- uiDivisor >= 256: estimate and correct --------------------------------
+hi_path:
+  push hl         ; [pRecip]
+  push bc         ; [uiDivisor][pRecip]
+  ld e, c
+  ld d, b
+  ld b, 0         ; B = number of shifts - 1
+hi_norm:
+  srl d
+  rr e
+  ld a, d
+  or a
+  jr z, hi_found
+  inc b
+  jr hi_norm
+
+hi_found:
+  ld a, e
+  and $7F
+  ld d, a
+  ld e, 4
+  mul d, e        ; DE = (m - 128) * 4
+  add hl, de
+  inc hl
+  ld e, (hl)
+  inc hl
+  ld d, (hl)      ; DE = pRecip[m - 128] >> 8
+  bsrl de, b      ; DE = q (estimate, q < 1024)
+
+  pop bc          ; BC = uiDivisor            [pRecip]
+  push de         ; [q][pRecip]
+
+  ; A:HL = P = q * uiDivisor (P < 2^18)
+  ld h, d         ; H = q_hi
+  ld l, e         ; L = q_lo
+  ld d, c
+  mul d, e        ; DE = f_lo * q_lo
+  push de         ; [lo][q][pRecip]
+  ld d, b
+  ld e, l
+  mul d, e        ; DE = f_hi * q_lo
+  ld a, h         ; A = q_hi
+  ex de, hl
+  ld d, c
+  ld e, a
+  mul d, e        ; DE = f_lo * q_hi
+  add hl, de      ; HL = mid (< 1024)
+  ld d, b
+  ld e, a
+  mul d, e        ; DE = f_hi * q_hi
+  ld a, e
+  add a, h
+  ld h, l
+  ld l, 0
+  pop de          ; DE = lo                   [q][pRecip]
+  add hl, de
+  adc a, 0
+
+  ; A:DE = P - pRecip[0] - 1
+  ex de, hl
+  pop hl          ; HL = q                    [pRecip]
+  ex (sp), hl     ; HL = pRecip               [q]
+  push bc         ; [uiDivisor][q]
+  ld c, a
+  ld a, e
+  scf
+  sbc a, (hl)
+  ld e, a
+  inc hl
+  ld a, d
+  sbc a, (hl)
+  ld d, a
+  inc hl
+  ld a, c
+  sbc a, (hl)
+  pop bc          ; BC = uiDivisor            [q]
+  pop hl          ; HL = q
+
+  ; while (P > pRecip[0]) { --q; P -= uiDivisor; }
+hi_corr:
+  bit 7, a
+  jr nz, hi_done
+  dec hl
+  ex de, hl
+  or a
+  sbc hl, bc
+  ex de, hl
+  sbc a, 0
+  jr hi_corr
+
+hi_done:
+  ld de, 0        ; DEHL = quotient
+  ret
@@ -0,0 +1,131 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: psg_calc_recip.c                                                   |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for programmable sound generators (AY-3-8912)                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include "libpsg.h"
+#include "psg_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+/*!
+Reciprocal of the normalized divisor "m" (128 .. 255), scaled by the dividend
+"n" and 2^7.
+*/
+#define PSG_RECIP(n, m) ((uint32_t) ((((uint32_t) (n)) * UINT32_C(128)) / (m)))
+
+/*!
+Eight consecutive entries of a table of reciprocals, starting at divisor "m".
+*/
+#define PSG_RECIP_ROW(n, m) PSG_RECIP(n, (m) + 0), PSG_RECIP(n, (m) + 1), \
+                            PSG_RECIP(n, (m) + 2), PSG_RECIP(n, (m) + 3), \
+                            PSG_RECIP(n, (m) + 4), PSG_RECIP(n, (m) + 5), \
+                            PSG_RECIP(n, (m) + 6), PSG_RECIP(n, (m) + 7)
+
+/*!
+Complete table of reciprocals (m = 128 .. 255) for the dividend "n".
+*/
+#define PSG_RECIP_TABLE(n) PSG_RECIP_ROW(n, 128), PSG_RECIP_ROW(n, 136), \
+                           PSG_RECIP_ROW(n, 144), PSG_RECIP_ROW(n, 152), \
+                           PSG_RECIP_ROW(n, 160), PSG_RECIP_ROW(n, 168), \
+                           PSG_RECIP_ROW(n, 176), PSG_RECIP_ROW(n, 184), \
+                           PSG_RECIP_ROW(n, 192), PSG_RECIP_ROW(n, 200), \
+                           PSG_RECIP_ROW(n, 208), PSG_RECIP_ROW(n, 216), \
+                           PSG_RECIP_ROW(n, 224), PSG_RECIP_ROW(n, 232), \
+                           PSG_RECIP_ROW(n, 240), PSG_RECIP_ROW(n, 248)
+
+/*!
+Dividend of the tone and noise generators: round(a / b) is computed as
+(floor(2 * a / b) + 1) / 2, so the doubled clock is used.
+*/
+#define PSG_DIVIDEND_TONE ((UINT32_C(2) * ((uint32_t) PSG_CLOCK)) / PSG_PRESCALER_FREQ)
+
+/*!
+Dividend of the envelope generators (see "PSG_DIVIDEND_TONE").
+*/
+#define PSG_DIVIDEND_ENV ((UINT32_C(2) * ((uint32_t) PSG_CLOCK)) / PSG_PRESCALER_ENV)
+
+#if (((2 * PSG_CLOCK) / PSG_PRESCALER_FREQ) >= 0x40000) || \
+    (((2 * PSG_CLOCK) / PSG_PRESCALER_ENV) >= 0x40000)
+  #error "psg_calc_period() requires dividends < 2^18"
+#endif
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+/*!
+Reciprocals for the calculation of tone and noise periods (first entry is the
+dividend itself).
+*/
+const uint32_t g_uiPsgRecipTone[PSG_RECIP_ENTRIES] =
+{
+  PSG_RECIP_TABLE(PSG_DIVIDEND_TONE)
+};
+
+/*!
+Reciprocals for the calculation of envelope periods (first entry is the dividend
+itself).
+*/
+const uint32_t g_uiPsgRecipEnv[PSG_RECIP_ENTRIES] =
+{
+  PSG_RECIP_TABLE(PSG_DIVIDEND_ENV)
+};
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
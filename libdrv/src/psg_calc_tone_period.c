@@ -75,8 +75,8 @@ uint16_t psg_calc_tone_period(uint16_t uiFrequency)
 {
   if (uiFrequency)
   {
-    uint32_t uiFreq = ((uint32_t) (PSG_PRESCALER_FREQ)) * ((uint32_t) uiFrequency);
-    return ((((uint32_t) PSG_CLOCK) + (uiFreq >> 1)) / uiFreq);
+    /* round(a / b) = (floor(2 * a / b) + 1) / 2 */
+    return (uint16_t) ((psg_calc_period(uiFrequency, g_uiPsgRecipTone) + 1) >> 1);
   }
 
   return 0;
@@ -0,0 +1,104 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: psg_crossfade_start.c                                              |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for programmable sound generators (AY-3-8912)                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <errno.h>
+#include "libpsg.h"
+#include "psg_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* psg_crossfade_start()                                                      */
+/*----------------------------------------------------------------------------*/
+uint8_t psg_crossfade_start(psgfade_t* pFade, psgstate_t* pState, const psgsnapshot_t* pFrom, const psgsnapshot_t* pTo, uint8_t uiFrames)
+{
+  if (pFade && pState && pFrom && pTo)
+  {
+    pFade->pState   = pState;
+    pFade->pFrom    = pFrom;
+    pFade->pTo      = pTo;
+    pFade->uiFrames = uiFrames;
+    pFade->uiFrame  = 0;
+
+    if (2 > uiFrames)
+    {
+      pFade->uiFrame = uiFrames;
+      return psg_restore(pState, pTo);
+    }
+
+    /* ramp down from 16.0 to 0.0 in "uiFrames / 2" frames */
+    pFade->tPriv.uiGain = PSG_FADE_GAIN_MAX;
+    pFade->tPriv.uiStep = PSG_FADE_GAIN_MAX / (uiFrames >> 1);
+
+    return EOK;
+  }
+
+  return EINVAL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
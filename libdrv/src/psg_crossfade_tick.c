@@ -0,0 +1,145 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: psg_crossfade_tick.c                                               |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for programmable sound generators (AY-3-8912)                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+#include "libpsg.h"
+#include "psg_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* psg_crossfade_tick()                                                       */
+/*----------------------------------------------------------------------------*/
+bool psg_crossfade_tick(psgfade_t* pFade) __z88dk_fastcall
+{
+  uint8_t uiBuffer[AY8912_REG_ENV_SHAPE + 1];
+  uint8_t uiHalf;
+  uint8_t uiCount;
+  uint8_t uiGain;
+  uint8_t i;
+
+  if (!pFade || !pFade->pState || (pFade->uiFrame >= pFade->uiFrames))
+  {
+    return false;
+  }
+
+  uiHalf = pFade->uiFrames >> 1;
+
+  if (pFade->uiFrame < uiHalf)
+  {
+    /* fade out: tone, noise, mixer of the source */
+    pFade->tPriv.uiGain = (pFade->tPriv.uiStep < pFade->tPriv.uiGain) ? pFade->tPriv.uiGain - pFade->tPriv.uiStep : 0;
+    memcpy(uiBuffer, pFade->pFrom->uiReg, AY8912_REG_CHN_C_AMPL + 1);
+    uiCount = AY8912_REG_CHN_C_AMPL + 1;
+
+    if (pFade->uiFrame == uiHalf - 1)
+    {
+      pFade->tPriv.uiGain = 0;
+    }
+  }
+  else
+  {
+    if (pFade->uiFrame == uiHalf)
+    {
+      /* switch: all registers of the target (incl. envelope) at once */
+      pFade->tPriv.uiGain = 0;
+      pFade->tPriv.uiStep = PSG_FADE_GAIN_MAX / (pFade->uiFrames - uiHalf);
+      uiCount = AY8912_REG_ENV_SHAPE + 1;
+    }
+    else
+    {
+      uiCount = AY8912_REG_CHN_C_AMPL + 1;
+    }
+
+    memcpy(uiBuffer, pFade->pTo->uiReg, uiCount);
+    pFade->tPriv.uiGain += pFade->tPriv.uiStep;
+
+    if ((pFade->uiFrame == pFade->uiFrames - 1) || (PSG_FADE_GAIN_MAX < pFade->tPriv.uiGain))
+    {
+      pFade->tPriv.uiGain = PSG_FADE_GAIN_MAX;
+    }
+  }
+
+  uiGain = (uint8_t) (pFade->tPriv.uiGain >> 8);
+
+  if (16 > uiGain)
+  {
+    for (i = AY8912_REG_CHN_A_AMPL; i <= AY8912_REG_CHN_C_AMPL; ++i)
+    {
+      /* envelope mode (BIT4) is faded with a fixed amplitude */
+      uiBuffer[i] = ((uiBuffer[i] & 0x10) ? 15 : (uiBuffer[i] & 0x0F)) * uiGain >> 4;
+    }
+  }
+
+  psg_write_regs(pFade->pState, AY8912_REG_CHN_A_FINE, uiCount, uiBuffer);
+
+  return (++pFade->uiFrame < pFade->uiFrames);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -74,6 +74,23 @@ If this macro is "unset", we read the values from hardware ...
 */
 #define __PSG_USE_REG_LATCH__
 
+/*!
+Number of entries of the tables of reciprocals used by "psg_calc_period()"
+(normalized divisors 128 .. 255).
+*/
+#define PSG_RECIP_ENTRIES (128)
+
+/*!
+Full gain of a crossfade (8.8 fixed point)
+*/
+#define PSG_FADE_GAIN_MAX (16 << 8)
+
+/*!
+Maximum offset of a tone period from portamento and pitch bending of a voice
+(full range of the tone period)
+*/
+#define PSG_VOICE_OFFSET_MAX (0x0FFF)
+
 /*============================================================================*/
 /*                               Constants                                    */
 /*============================================================================*/
@@ -92,7 +109,21 @@ BIT[5]    reserved
 BIT[4:0]  Selected PSG-register (0 .. 15)
 @endcode
 */
+#if defined(__SDCC)
 __sfr __banked __at 0xBFF5 IO_PSG_SEL;
+#endif
+
+/*!
+Table of reciprocals to calculate periods of the tone and noise generators
+(see "psg_calc_recip.c")
+*/
+extern const uint32_t g_uiPsgRecipTone[PSG_RECIP_ENTRIES];
+
+/*!
+Table of reciprocals to calculate periods of the envelope generators
+(see "psg_calc_recip.c")
+*/
+extern const uint32_t g_uiPsgRecipEnv[PSG_RECIP_ENTRIES];
 
 /*============================================================================*/
 /*                               Structures                                   */
@@ -127,6 +158,30 @@ structure ("0" = first AY-3-8912, "1" = second AY-3-8912, ..)
 */
 uint8_t psg_read_reg(psgstate_t* pState, uint8_t uiReg);
 
+/*!
+Write consecutive registers of a PSG (AY-3-8912) by an unrolled sequence of
+OUT-instructions (without latching the values).
+@param pValues Values to write
+@param uiFirst Index of the first register to write
+@param uiCount Number of registers to write (uiFirst + uiCount <= 16)
+@param uiIndex Index of the PSG ("0" .. "2")
+*/
+void psg_write_block_callee(const uint8_t* pValues, uint8_t uiFirst, uint8_t uiCount, uint8_t uiIndex) __z88dk_callee;
+#define psg_write_block(w, x, y, z) psg_write_block_callee(w, x, y, z)
+
+/*!
+Division-free kernel of all period calculations: "floor(pRecip[0] / uiDivisor)".
+The quotient is looked up in a table of reciprocals and corrected with the
+remainder, that is computed with the Z80N instruction "MUL D,E".
+@param uiDivisor Divisor ("1" .. "65535")
+@param pRecip Table of reciprocals of the dividend (i.e. "g_uiPsgRecipTone")
+@return Quotient
+@remark
+No static data is used, so the function can be called from interrupt handlers.
+*/
+uint32_t psg_calc_period_callee(uint16_t uiDivisor, const uint32_t* pRecip) __z88dk_callee;
+#define psg_calc_period(x, y) psg_calc_period_callee(x, y)
+
 /*============================================================================*/
 /*                               Implementation                               */
 /*============================================================================*/
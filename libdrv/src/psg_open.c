@@ -76,7 +76,7 @@ uint8_t psg_open(psgstate_t* pState, uint8_t uiIndex)
 {
   if (pState)
   {
-    memset(pState, 0, sizeof(pState));
+    memset(pState, 0, sizeof(psgstate_t));
     pState->uiIndex = uiIndex;
 
     return EOK;
@@ -0,0 +1,109 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: psg_voice_note_on.c                                                |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for programmable sound generators (AY-3-8912)                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <errno.h>
+#include "libzxn.h"
+#include "libpsg.h"
+#include "psg_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* psg_voice_note_on()                                                        */
+/*----------------------------------------------------------------------------*/
+uint8_t psg_voice_note_on(psgvoice_t* pVoice, uint8_t uiNote)
+{
+  if (pVoice && pVoice->pInstr)
+  {
+    if (pVoice->pInstr->uiPorta && (PSG_VOICE_OFF != pVoice->tPriv.uiPhase))
+    {
+      /* glide from the current period to the new note */
+      pVoice->tPriv.iGlide += (int16_t) psg_calc_note_period(pVoice->tPriv.uiNote)
+                            - (int16_t) psg_calc_note_period(uiNote);
+      pVoice->tPriv.iGlide  = ZXN_CONSTRAIN(pVoice->tPriv.iGlide, -PSG_VOICE_OFFSET_MAX, PSG_VOICE_OFFSET_MAX);
+    }
+    else
+    {
+      pVoice->tPriv.iGlide = 0;
+    }
+
+    pVoice->tPriv.uiNote     = uiNote;
+    pVoice->tPriv.uiPhase    = PSG_VOICE_ATTACK;
+    pVoice->tPriv.uiArpPos   = 0;
+    pVoice->tPriv.uiVibPhase = 0;
+    pVoice->tPriv.uiVibDelay = pVoice->pInstr->uiVibDelay;
+    pVoice->tPriv.iBend      = 0;
+    pVoice->tPriv.iBendStep  = 0;
+
+    return EOK;
+  }
+
+  return EINVAL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,235 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: psg_voice_tick.c                                                   |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Driver for programmable sound generators (AY-3-8912)                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <errno.h>
+#include "libzxn.h"
+#include "libpsg.h"
+#include "psg_internal.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+/*!
+Maximum amplitude of a voice (4.4 fixed point)
+*/
+#define PSG_VOICE_LEVEL_MAX (0xF0)
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+/*!
+One cycle of a sine wave (vibrato)
+*/
+static const int8_t g_iPsgVibrato[32] =
+{
+     0,   25,   49,   71,   90,  106,  117,  125,
+   127,  125,  117,  106,   90,   71,   49,   25,
+     0,  -25,  -49,  -71,  -90, -106, -117, -125,
+  -127, -125, -117, -106,  -90,  -71,  -49,  -25
+};
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+/*!
+Compute the next tick of a single voice into the register latch.
+@param pState Pointer to device structure
+@param pVoice Pointer to the voice structure
+*/
+static void psg_voice_step(psgstate_t* pState, psgvoice_t* pVoice);
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* psg_voice_tick()                                                           */
+/*----------------------------------------------------------------------------*/
+uint8_t psg_voice_tick(psgstate_t* pState, psgvoice_t* pVoices, uint8_t uiCount)
+{
+  if (pState && pVoices)
+  {
+    while (uiCount--)
+    {
+      psg_voice_step(pState, pVoices++);
+    }
+
+    /* periods A, B, C (0 .. 5) and amplitudes A, B, C (8 .. 10) */
+    psg_write_block(&pState->uiReg[AY8912_REG_CHN_A_FINE], AY8912_REG_CHN_A_FINE, 6, pState->uiIndex);
+    psg_write_block(&pState->uiReg[AY8912_REG_CHN_A_AMPL], AY8912_REG_CHN_A_AMPL, 3, pState->uiIndex);
+
+    return EOK;
+  }
+
+  return EINVAL;
+}
+
+/*----------------------------------------------------------------------------*/
+/* psg_voice_step()                                                           */
+/*----------------------------------------------------------------------------*/
+static void psg_voice_step(psgstate_t* pState, psgvoice_t* pVoice)
+{
+  const psginstr_t* pInstr = pVoice->pInstr;
+  int16_t iNote;
+  int16_t iPeriod;
+
+  if ((PSG_CHANNEL_C < pVoice->uiChannel) || !pInstr)
+  {
+    return;
+  }
+
+  /*--- amplitude envelope (ADSR) --------------------------------------------*/
+  switch (pVoice->tPriv.uiPhase)
+  {
+    case PSG_VOICE_ATTACK:
+      if (!pInstr->uiAttack || ((PSG_VOICE_LEVEL_MAX - pVoice->tPriv.uiLevel) <= pInstr->uiAttack))
+      {
+        pVoice->tPriv.uiLevel = PSG_VOICE_LEVEL_MAX;
+        pVoice->tPriv.uiPhase = PSG_VOICE_DECAY;
+      }
+      else
+      {
+        pVoice->tPriv.uiLevel += pInstr->uiAttack;
+      }
+      break;
+
+    case PSG_VOICE_DECAY:
+      if (!pInstr->uiDecay || ((pVoice->tPriv.uiLevel - (pInstr->uiSustain << 4)) <= pInstr->uiDecay))
+      {
+        pVoice->tPriv.uiLevel = pInstr->uiSustain << 4;
+        pVoice->tPriv.uiPhase = PSG_VOICE_SUSTAIN;
+      }
+      else
+      {
+        pVoice->tPriv.uiLevel -= pInstr->uiDecay;
+      }
+      break;
+
+    case PSG_VOICE_RELEASE:
+      if (!pInstr->uiRelease || (pVoice->tPriv.uiLevel <= pInstr->uiRelease))
+      {
+        pVoice->tPriv.uiLevel = 0;
+        pVoice->tPriv.uiPhase = PSG_VOICE_OFF;
+      }
+      else
+      {
+        pVoice->tPriv.uiLevel -= pInstr->uiRelease;
+      }
+      break;
+
+    default:
+      break;
+  }
+
+  pState->uiReg[AY8912_REG_CHN_A_AMPL + pVoice->uiChannel] = pVoice->tPriv.uiLevel >> 4;
+
+  if (PSG_VOICE_OFF == pVoice->tPriv.uiPhase)
+  {
+    return;
+  }
+
+  /*--- arpeggio -------------------------------------------------------------*/
+  iNote = pVoice->tPriv.uiNote;
+
+  if (pInstr->pArp && pInstr->uiArpLength)
+  {
+    /* offsets, that leave the range of notes, are saturated */
+    iNote += pInstr->pArp[pVoice->tPriv.uiArpPos];
+    iNote  = ZXN_CONSTRAIN(iNote, 0, PSG_NOTE_MAX);
+
+    if (pInstr->uiArpLength <= ++pVoice->tPriv.uiArpPos)
+    {
+      pVoice->tPriv.uiArpPos = 0;
+    }
+  }
+
+  iPeriod = (int16_t) psg_calc_note_period((uint8_t) iNote);
+
+  /*--- portamento, bend -----------------------------------------------------*/
+  if (pVoice->tPriv.iGlide > pInstr->uiPorta)
+  {
+    pVoice->tPriv.iGlide -= pInstr->uiPorta;
+  }
+  else if (pVoice->tPriv.iGlide < -((int16_t) pInstr->uiPorta))
+  {
+    pVoice->tPriv.iGlide += pInstr->uiPorta;
+  }
+  else
+  {
+    pVoice->tPriv.iGlide = 0;
+  }
+
+  /* saturated, so a held bend can't overflow: |offsets| <= 2 * 0x0FFF */
+  pVoice->tPriv.iBend += pVoice->tPriv.iBendStep;
+  pVoice->tPriv.iBend  = ZXN_CONSTRAIN(pVoice->tPriv.iBend, -PSG_VOICE_OFFSET_MAX, PSG_VOICE_OFFSET_MAX);
+  iPeriod += pVoice->tPriv.iGlide + pVoice->tPriv.iBend;
+
+  /*--- vibrato --------------------------------------------------------------*/
+  if (pVoice->tPriv.uiVibDelay)
+  {
+    --pVoice->tPriv.uiVibDelay;
+  }
+  else if (pInstr->uiVibDepth)
+  {
+    iPeriod += (int16_t) (g_iPsgVibrato[pVoice->tPriv.uiVibPhase >> 3] * (int16_t) pInstr->uiVibDepth) >> 7;
+    pVoice->tPriv.uiVibPhase += pInstr->uiVibSpeed;
+  }
+
+  iPeriod = ZXN_CONSTRAIN(iPeriod, 1, 0x0FFF);
+
+  pState->uiReg[AY8912_REG_CHN_A_FINE   + (pVoice->uiChannel << 1)] = (uint8_t) (iPeriod & 0xFF);
+  pState->uiReg[AY8912_REG_CHN_A_COARSE + (pVoice->uiChannel << 1)] = (uint8_t) (iPeriod >> 8);
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,138 @@
+SECTION code_user
+PUBLIC _psg_write_block_callee
+
+IO_AY_REG_HI  equ $FF   ; port 0xFFFD: select register/chip (Turbosound)
+IO_AY_DAT_HI  equ $BF   ; port 0xBFFD: write register
+IO_AY_LO      equ $FD
+BLOCK_SIZE    equ 9     ; size of one unrolled register write in bytes
+BLOCK_COUNT   equ 16
+
+; ==============================================================================
+; void psg_write_block_callee(const uint8_t* pValues,
+;                             uint8_t uiFirst,
+;                             uint8_t uiCount,
+;                             uint8_t uiIndex)
+; ------------------------------------------------------------------------------
+; writes "uiCount" consecutive registers of a PSG, starting at "uiFirst"
+; ------------------------------------------------------------------------------
+; The PSG "uiIndex" (0 .. 2) is selected once; the registers are written by an
+; unrolled sequence of "OUT (C),E/OUTI" (B = 0xC0 is decremented to 0xBF by
+; OUTI). The entry point into the sequence is computed from "uiCount", so no
+; loop counter is needed. uiFirst + uiCount must not exceed 16.
+; ==============================================================================
+_psg_write_block_callee:
+  pop hl          ; return address
+  pop de          ; DE = pValues
+  pop bc          ; C = uiFirst, B = uiCount
+  dec sp
+  pop af          ; A = uiIndex
+  push hl
+
+  and $03
+  xor $03         ; 3 - uiIndex
+  or $FC          ; BIT7, BIT4:2 = 1; BIT6:5 = left/right audio on
+  ld h, b         ; H = uiCount
+  ld l, c         ; L = uiFirst
+  ld bc, IO_AY_REG_HI * 256 + IO_AY_LO
+  out (c), a      ; select PSG
+
+  ld a, h
+  or a
+  ret z
+  cp BLOCK_COUNT + 1
+  ret nc
+
+  push de         ; [pValues]
+  ld d, a
+  ld e, BLOCK_SIZE
+  mul d, e        ; DE = uiCount * BLOCK_SIZE
+  ld a, l         ; A = uiFirst
+  ld hl, write_end
+  or a
+  sbc hl, de      ; HL = entry point into the unrolled sequence
+  ex (sp), hl     ; HL = pValues, [entry]
+  ld e, a         ; E = register
+  ret             ; jump to entry point
+
+  ld b, IO_AY_REG_HI
+  out (c), e      ; select register
+  ld b, IO_AY_DAT_HI + 1
+  outi            ; B = IO_AY_DAT_HI; write (HL++)
+  inc e
+  ld b, IO_AY_REG_HI
+  out (c), e      ; select register
+  ld b, IO_AY_DAT_HI + 1
+  outi            ; B = IO_AY_DAT_HI; write (HL++)
+  inc e
+  ld b, IO_AY_REG_HI
+  out (c), e      ; select register
+  ld b, IO_AY_DAT_HI + 1
+  outi            ; B = IO_AY_DAT_HI; write (HL++)
+  inc e
+  ld b, IO_AY_REG_HI
+  out (c), e      ; select register
+  ld b, IO_AY_DAT_HI + 1
+  outi            ; B = IO_AY_DAT_HI; write (HL++)
+  inc e
+  ld b, IO_AY_REG_HI
+  out (c), e      ; select register
+  ld b, IO_AY_DAT_HI + 1
+  outi            ; B = IO_AY_DAT_HI; write (HL++)
+  inc e
+  ld b, IO_AY_REG_HI
+  out (c), e      ; select register
+  ld b, IO_AY_DAT_HI + 1
+  outi            ; B = IO_AY_DAT_HI; write (HL++)
+  inc e
+  ld b, IO_AY_REG_HI
+  out (c), e      ; select register
+  ld b, IO_AY_DAT_HI + 1
+  outi            ; B = IO_AY_DAT_HI; write (HL++)
+  inc e
+  ld b, IO_AY_REG_HI
+  out (c), e      ; select register
+  ld b, IO_AY_DAT_HI + 1
+  outi            ; B = IO_AY_DAT_HI; write (HL++)
+  inc e
+  ld b, IO_AY_REG_HI
+  out (c), e      ; select register
+  ld b, IO_AY_DAT_HI + 1
+  outi            ; B = IO_AY_DAT_HI; write (HL++)
+  inc e
+  ld b, IO_AY_REG_HI
+  out (c), e      ; select register
+  ld b, IO_AY_DAT_HI + 1
+  outi            ; B = IO_AY_DAT_HI; write (HL++)
+  inc e
+  ld b, IO_AY_REG_HI
+  out (c), e      ; select register
+  ld b, IO_AY_DAT_HI + 1
+  outi            ; B = IO_AY_DAT_HI; write (HL++)
+  inc e
+  ld b, IO_AY_REG_HI
+  out (c), e      ; select register
+  ld b, IO_AY_DAT_HI + 1
+  outi            ; B = IO_AY_DAT_HI; write (HL++)
+  inc e
+  ld b, IO_AY_REG_HI
+  out (c), e      ; select register
+  ld b, IO_AY_DAT_HI + 1
+  outi            ; B = IO_AY_DAT_HI; write (HL++)
+  inc e
+  ld b, IO_AY_REG_HI
+  out (c), e      ; select register
+  ld b, IO_AY_DAT_HI + 1
+  outi            ; B = IO_AY_DAT_HI; write (HL++)
+  inc e
+  ld b, IO_AY_REG_HI
+  out (c), e      ; select register
+  ld b, IO_AY_DAT_HI + 1
+  outi            ; B = IO_AY_DAT_HI; write (HL++)
+  inc e
+  ld b, IO_AY_REG_HI
+  out (c), e      ; select register
+  ld b, IO_AY_DAT_HI + 1
+  outi            ; B = IO_AY_DAT_HI; write (HL++)
+  inc e
+write_end:
+  ret
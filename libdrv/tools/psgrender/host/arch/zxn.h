@@ -0,0 +1,62 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: zxn.h                                                              |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Host (Linux) replacement of <arch/zxn.h>: next-registers are mapped to the   |
+| simulation of psgrender                                                      |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__HOST_ARCH_ZXN_H__)
+  #define __HOST_ARCH_ZXN_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include "psgsim.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+#define ZXN_READ_REG(reg)       psgsim_nreg_read(reg)
+#define ZXN_WRITE_REG(reg, val) psgsim_nreg_write((reg), (val))
+
+#define REG_PERIPHERAL_2      (0x06)
+#define REG_TURBO_MODE        (0x07)
+#define REG_PERIPHERAL_3      (0x08)
+#define REG_PERIPHERAL_4      (0x09)
+#define RP3_ENABLE_TURBOSOUND (0x02)
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __HOST_ARCH_ZXN_H__ */
@@ -0,0 +1,62 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: libzxn.h                                                           |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Host (Linux) replacement of "libzxn.h": only the macros used by libpsg, so   |
+| the host build doesn't depend on the Z80 specific parts of libzxn            |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__HOST_LIBZXN_H__)
+  #define __HOST_LIBZXN_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+/*!
+Checks, if a value is between two limits (see "libzxn.h")
+*/
+#define ZXN_BETWEEN(val, min, max) (((min) <= (val)) && ((val) <= (max)))
+
+/*!
+Limits a value to a range (see "libzxn.h")
+*/
+#define ZXN_CONSTRAIN(val, min, max) ((val) <= (min) ? (min) : ((val) >= (max) ? (max) : (val)))
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __HOST_LIBZXN_H__ */
@@ -0,0 +1,230 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: psgmath.c                                                          |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Host (Linux) test of the period calculations of libpsg: the C model of the   |
+| kernel psg_calc_period.asm (psgsim.c) and all psg_calc_*_period() functions  |
+| are compared with the former division based results for all inputs           |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdio.h>
+#include <arch/zxn.h>
+#include "libpsg.h"
+#include "psg_internal.h"
+#include "psgsim.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+/*!
+Maximum number of corrections of the estimate of "psg_calc_period" for all
+dividends < 2^18 (see psg_calc_period.asm)
+*/
+#define PSGMATH_MAX_CORRECTIONS (4)
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+/*!
+Reference implementations: the division based calculations of libpsg before
+the kernel "psg_calc_period" was introduced.
+@param uiFrequency Frequency in [Hz] (1 .. 65535)
+@param uiTime Time in [ms]
+@return Period value
+*/
+static uint16_t psgmath_ref_tone(uint16_t uiFrequency);
+static uint8_t  psgmath_ref_noise(uint16_t uiFrequency);
+static uint16_t psgmath_ref_envelope(uint16_t uiFrequency);
+static uint16_t psgmath_ref_envelope_ms(uint16_t uiTime);
+
+/*!
+Check the kernel "psg_calc_period" for all divisors with a table of
+reciprocals.
+@param acName Name of the table (output only)
+@param pRecip Table of reciprocals
+@return Number of errors
+*/
+static uint32_t psgmath_check_kernel(const char* acName, const uint32_t* pRecip);
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* main()                                                                     */
+/*----------------------------------------------------------------------------*/
+int main(void)
+{
+  uint32_t uiErrors = 0;
+
+  uiErrors += psgmath_check_kernel("tone", g_uiPsgRecipTone);
+  uiErrors += psgmath_check_kernel("envelope", g_uiPsgRecipEnv);
+
+  for (uint32_t i = 1; i <= UINT16_MAX; ++i)
+  {
+    const uint16_t uiValue = (uint16_t) i;
+
+    if (psg_calc_tone_period(uiValue) != psgmath_ref_tone(uiValue))
+    {
+      printf("psg_calc_tone_period(%u): %u, expected %u\n", uiValue,
+             psg_calc_tone_period(uiValue), psgmath_ref_tone(uiValue));
+      ++uiErrors;
+    }
+
+    if (psg_calc_noise_period(uiValue) != psgmath_ref_noise(uiValue))
+    {
+      printf("psg_calc_noise_period(%u): %u, expected %u\n", uiValue,
+             psg_calc_noise_period(uiValue), psgmath_ref_noise(uiValue));
+      ++uiErrors;
+    }
+
+    if (psg_calc_envelope_period(uiValue) != psgmath_ref_envelope(uiValue))
+    {
+      printf("psg_calc_envelope_period(%u): %u, expected %u\n", uiValue,
+             psg_calc_envelope_period(uiValue), psgmath_ref_envelope(uiValue));
+      ++uiErrors;
+    }
+  }
+
+  for (uint32_t i = 0; i <= UINT16_MAX; ++i)
+  {
+    const uint16_t uiValue = (uint16_t) i;
+
+    if (psg_calc_envelope_period_ms(uiValue) != psgmath_ref_envelope_ms(uiValue))
+    {
+      printf("psg_calc_envelope_period_ms(%u): %u, expected %u\n", uiValue,
+             psg_calc_envelope_period_ms(uiValue), psgmath_ref_envelope_ms(uiValue));
+      ++uiErrors;
+    }
+  }
+
+  printf("psg_calc_*_period: %s (%lu errors)\n", uiErrors ? "FAILED" : "identical", (unsigned long) uiErrors);
+  return uiErrors ? 1 : EOK;
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgmath_check_kernel()                                                     */
+/*----------------------------------------------------------------------------*/
+static uint32_t psgmath_check_kernel(const char* acName, const uint32_t* pRecip)
+{
+  uint32_t uiErrors = 0;
+  uint8_t  uiMax = 0;
+  uint8_t  uiCorrections;
+
+  for (uint32_t i = 1; i <= UINT16_MAX; ++i)
+  {
+    const uint32_t uiQuot = psgsim_calc_period((uint16_t) i, pRecip, &uiCorrections);
+
+    if (uiQuot != pRecip[0] / i)
+    {
+      printf("psg_calc_period(%lu, %s): %lu, expected %lu\n", (unsigned long) i, acName,
+             (unsigned long) uiQuot, (unsigned long) (pRecip[0] / i));
+      ++uiErrors;
+    }
+
+    uiMax = (uiCorrections > uiMax) ? uiCorrections : uiMax;
+  }
+
+  printf("psg_calc_period(%s): max. %u corrections\n", acName, uiMax);
+
+  if (PSGMATH_MAX_CORRECTIONS < uiMax)
+  {
+    ++uiErrors;
+  }
+
+  return uiErrors;
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgmath_ref_tone()                                                         */
+/*----------------------------------------------------------------------------*/
+static uint16_t psgmath_ref_tone(uint16_t uiFrequency)
+{
+  uint32_t uiFreq = ((uint32_t) (PSG_PRESCALER_FREQ)) * ((uint32_t) uiFrequency);
+  return ((((uint32_t) PSG_CLOCK) + (uiFreq >> 1)) / uiFreq);
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgmath_ref_noise()                                                        */
+/*----------------------------------------------------------------------------*/
+static uint8_t psgmath_ref_noise(uint16_t uiFrequency)
+{
+  uint32_t uiFreq = ((uint32_t) (PSG_PRESCALER_NOISE)) * ((uint32_t) uiFrequency);
+  return (((uint32_t) PSG_CLOCK) + (uiFreq >> 1)) / uiFreq;
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgmath_ref_envelope()                                                     */
+/*----------------------------------------------------------------------------*/
+static uint16_t psgmath_ref_envelope(uint16_t uiFrequency)
+{
+  uint32_t uiFreq = ((uint32_t) (PSG_PRESCALER_ENV)) * ((uint32_t) uiFrequency);
+  return ((((uint32_t) PSG_CLOCK) + (uiFreq >> 1)) / uiFreq);
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgmath_ref_envelope_ms()                                                  */
+/*----------------------------------------------------------------------------*/
+static uint16_t psgmath_ref_envelope_ms(uint16_t uiTime)
+{
+  const uint16_t uiSec  = uiTime / UINT16_C(1000);
+  const uint16_t uiMSec = uiTime - (uiSec * UINT16_C(1000));
+  const uint32_t uiDENOM = ((uint32_t) PSG_PRESCALER_ENV) * UINT32_C(1000);
+
+  const uint32_t uiResult_s  = (((uint32_t) PSG_CLOCK) * ((uint32_t) uiSec)) / ((uint32_t) PSG_PRESCALER_ENV);
+  const uint32_t uiResult_ms = ((((uint32_t) PSG_CLOCK) * ((uint32_t) uiMSec)) + (uiDENOM / 2)) / uiDENOM;
+
+  return (uint16_t) (uiResult_s + uiResult_ms);
+}
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
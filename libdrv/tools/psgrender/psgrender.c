@@ -0,0 +1,378 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: psgrender.c                                                        |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Host (Linux) tool to render traces of PSG register writes to WAV-files       |
+| (regression tests and benchmarks of libpsg without a ZX Spectrum Next)       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+#include <arch/zxn.h>
+#include "libpsg.h"
+#include "psg_internal.h"
+#include "psgsim.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+/*!
+Default number of frames, that are rendered after the last event of the trace
+*/
+#define PSGRENDER_DEFAULT_TAIL (50)
+
+/*!
+Maximum length of a line of a trace
+*/
+#define PSGRENDER_MAX_LINE (128)
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+/*!
+Usage information of the tool
+*/
+static const char g_acUsage[] =
+  "usage: psgrender [options] trace\n"
+  "  -o file   write rendered audio to WAV-file\n"
+  "  -c file   compare rendered audio with WAV-file (exit code 1 on differences)\n"
+  "  -r rate   sample rate in [Hz] (default: 44100)\n"
+  "  -f fps    frames per second (default: 50)\n"
+  "  -t frames frames to render after the last event (default: 50)\n"
+  "  -k core   initial sound core: 0 = YM2149, 1 = AY-3-8912 (default: 0)\n"
+  "  -b        print benchmark of the rendering\n"
+  "\n"
+  "trace: one register write per line (see psgsim_trace())\n"
+  "  W <frame> <chip> <reg> <value>   write PSG-register\n"
+  "  N <frame> <reg> <value>          write next-register\n";
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+/*!
+Options of the tool (parsed from the command line)
+*/
+typedef struct _options
+{
+  const char* acTrace;
+  const char* acOutput;
+  const char* acCompare;
+  uint32_t uiRate;
+  uint32_t uiFps;
+  uint32_t uiTail;
+  uint8_t uiCore;
+  uint8_t bBenchmark;
+} options_t;
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+/*!
+Parse the command line.
+@param pOptions [OUT] Parsed options
+@param argc Number of arguments
+@param argv Arguments
+@return EOK = no error
+*/
+static int psgrender_options(options_t* pOptions, int argc, char* argv[]);
+
+/*!
+Compare the rendered audio with a reference WAV-file.
+@param acFile Name of the reference
+@param uiRate Sample rate of the rendered audio
+@param pSamples Rendered audio
+@param uiFrames Number of stereo samples of the rendered audio
+@return EOK = identical
+*/
+static int psgrender_compare(const char* acFile, uint32_t uiRate, const int16_t* pSamples, uint32_t uiFrames);
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* main()                                                                     */
+/*----------------------------------------------------------------------------*/
+int main(int argc, char* argv[])
+{
+  options_t tOptions;
+  FILE* pTrace;
+  char acLine[PSGRENDER_MAX_LINE];
+  long iLast = 0;
+
+  if (EOK != psgrender_options(&tOptions, argc, argv))
+  {
+    fputs(g_acUsage, stderr);
+    return 2;
+  }
+
+  if (!(pTrace = fopen(tOptions.acTrace, "r")))
+  {
+    perror(tOptions.acTrace);
+    return 2;
+  }
+
+  /* first pass: number of frames to render */
+  while (fgets(acLine, sizeof(acLine), pTrace))
+  {
+    unsigned long uiFrame;
+
+    if (1 == sscanf(acLine, " %*[WN] %lu", &uiFrame))
+    {
+      iLast = ((long) uiFrame > iLast) ? (long) uiFrame : iLast;
+    }
+  }
+
+  const uint32_t uiFrames  = (uint32_t) iLast + 1 + tOptions.uiTail;
+  const uint32_t uiSamples = (uint32_t) (((uint64_t) uiFrames * tOptions.uiRate) / tOptions.uiFps);
+  int16_t* pSamples = calloc((size_t) uiSamples * 2 + 2, sizeof(int16_t));
+
+  if (!pSamples)
+  {
+    fclose(pTrace);
+    return 2;
+  }
+
+  /* second pass: apply all writes at their frame and render */
+  psgsim_reset(tOptions.uiRate);
+  psgsim_nreg_write(REG_PERIPHERAL_2, tOptions.uiCore & 0x03);
+  rewind(pTrace);
+
+  const clock_t tStart = clock();
+  uint32_t uiDone = 0;
+  long iPending = -1;
+
+  for (uint32_t uiFrame = 0; uiFrame < uiFrames; ++uiFrame)
+  {
+    const uint32_t uiEnd = (uint32_t) (((uint64_t) (uiFrame + 1) * tOptions.uiRate) / tOptions.uiFps);
+
+    if ((iPending >= 0) && ((uint32_t) iPending == uiFrame))
+    {
+      psgsim_apply(acLine);
+      iPending = -1;
+    }
+
+    while ((iPending < 0) && fgets(acLine, sizeof(acLine), pTrace))
+    {
+      unsigned long uiStamp;
+
+      if (1 == sscanf(acLine, " %*[WN] %lu", &uiStamp))
+      {
+        if (uiStamp <= uiFrame)
+        {
+          psgsim_apply(acLine);
+        }
+        else
+        {
+          iPending = (long) uiStamp;
+        }
+      }
+    }
+
+    psgsim_render(&pSamples[uiDone << 1], uiEnd - uiDone);
+    uiDone = uiEnd;
+  }
+
+  const double dSeconds = ((double) (clock() - tStart)) / CLOCKS_PER_SEC;
+  fclose(pTrace);
+
+  if (tOptions.bBenchmark)
+  {
+    const double dAudio = ((double) uiSamples) / tOptions.uiRate;
+    printf("frames: %lu, audio: %.2f s, render: %.3f s (%.1f x realtime)\n",
+           (unsigned long) uiFrames, dAudio, dSeconds, (dSeconds > 0.0) ? (dAudio / dSeconds) : 0.0);
+  }
+
+  if (tOptions.acOutput)
+  {
+    FILE* pFile = fopen(tOptions.acOutput, "wb");
+
+    if (!pFile)
+    {
+      perror(tOptions.acOutput);
+      free(pSamples);
+      return 2;
+    }
+
+    psgsim_wav_header(pFile, tOptions.uiRate, uiSamples);
+
+    for (uint32_t i = 0; i < (uiSamples << 1); ++i)
+    {
+      fputc(((uint16_t) pSamples[i]) & 0xFF, pFile);
+      fputc(((uint16_t) pSamples[i]) >> 8, pFile);
+    }
+
+    fclose(pFile);
+  }
+
+  int iReturn = EOK;
+
+  if (tOptions.acCompare)
+  {
+    iReturn = psgrender_compare(tOptions.acCompare, tOptions.uiRate, pSamples, uiSamples);
+  }
+
+  free(pSamples);
+  return iReturn;
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgrender_options()                                                        */
+/*----------------------------------------------------------------------------*/
+static int psgrender_options(options_t* pOptions, int argc, char* argv[])
+{
+  memset(pOptions, 0, sizeof(*pOptions));
+  pOptions->uiRate = PSGSIM_DEFAULT_RATE;
+  pOptions->uiFps  = PSGSIM_DEFAULT_FPS;
+  pOptions->uiTail = PSGRENDER_DEFAULT_TAIL;
+  pOptions->uiCore = PSG_CORE_YM;
+
+  for (int i = 1; i < argc; ++i)
+  {
+    const char* acArg = argv[i];
+
+    if (('-' == acArg[0]) && acArg[1] && !acArg[2])
+    {
+      if ('b' == acArg[1])
+      {
+        pOptions->bBenchmark = 1;
+        continue;
+      }
+
+      if (++i >= argc)
+      {
+        return EINVAL;
+      }
+
+      switch (acArg[1])
+      {
+        case 'o': pOptions->acOutput  = argv[i]; break;
+        case 'c': pOptions->acCompare = argv[i]; break;
+        case 'r': pOptions->uiRate    = (uint32_t) strtoul(argv[i], 0, 0); break;
+        case 'f': pOptions->uiFps     = (uint32_t) strtoul(argv[i], 0, 0); break;
+        case 't': pOptions->uiTail    = (uint32_t) strtoul(argv[i], 0, 0); break;
+        case 'k': pOptions->uiCore    = (uint8_t)  strtoul(argv[i], 0, 0); break;
+        default:  return EINVAL;
+      }
+    }
+    else if (!pOptions->acTrace)
+    {
+      pOptions->acTrace = acArg;
+    }
+    else
+    {
+      return EINVAL;
+    }
+  }
+
+  return (pOptions->acTrace && pOptions->uiRate && pOptions->uiFps) ? EOK : EINVAL;
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgrender_compare()                                                        */
+/*----------------------------------------------------------------------------*/
+static int psgrender_compare(const char* acFile, uint32_t uiRate, const int16_t* pSamples, uint32_t uiFrames)
+{
+  FILE* pFile = fopen(acFile, "rb");
+  uint32_t uiRefRate   = 0;
+  uint32_t uiRefFrames = 0;
+  int16_t* pRef = 0;
+
+  if (!pFile)
+  {
+    perror(acFile);
+    return 2;
+  }
+
+  pRef = psgsim_wav_read(pFile, &uiRefRate, &uiRefFrames);
+  fclose(pFile);
+
+  if (!pRef)
+  {
+    fprintf(stderr, "%s: invalid WAV-file\n", acFile);
+    return 2;
+  }
+
+  if ((uiRefRate != uiRate) || (uiRefFrames != uiFrames))
+  {
+    printf("%s: DIFFERENT (rate %lu/%lu, samples %lu/%lu)\n", acFile,
+           (unsigned long) uiRate, (unsigned long) uiRefRate,
+           (unsigned long) uiFrames, (unsigned long) uiRefFrames);
+    free(pRef);
+    return 1;
+  }
+
+  uint32_t uiDiffs = 0;
+  uint32_t uiFirst = 0;
+  int iMax = 0;
+
+  for (uint32_t i = 0; i < (uiFrames << 1); ++i)
+  {
+    const int iDiff = abs((int) pSamples[i] - (int) pRef[i]);
+
+    if (iDiff)
+    {
+      uiFirst = (uiDiffs ? uiFirst : (i >> 1));
+      iMax = (iDiff > iMax) ? iDiff : iMax;
+      ++uiDiffs;
+    }
+  }
+
+  free(pRef);
+
+  if (uiDiffs)
+  {
+    printf("%s: DIFFERENT (%lu values, first at sample %lu, max. delta %d)\n", acFile,
+           (unsigned long) uiDiffs, (unsigned long) uiFirst, iMax);
+    return 1;
+  }
+
+  printf("%s: identical\n", acFile);
+  return EOK;
+}
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,423 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: psgscene.c                                                         |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Host (Linux) driver, that plays scenarios through libpsg (simulated port     |
+| layer) and traces all register writes; the traces are rendered and compared  |
+| with golden WAV-files by psgrender ("make test")                             |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <arch/zxn.h>
+#include "libpsg.h"
+#include "psg_internal.h"
+#include "psgsim.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+/*!
+Number of entries of an array
+*/
+#define PSGSCENE_COUNT(x) (sizeof(x) / sizeof((x)[0]))
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+/*!
+Usage information of the tool
+*/
+static const char g_acUsage[] =
+  "usage: psgscene scenario trace\n"
+  "       psgscene -l\n"
+  "  scenario  name of the scenario, that is played through libpsg\n"
+  "  trace     file, that receives all register writes (see psgrender)\n"
+  "  -l        list all scenarios\n";
+
+/*!
+Arpeggio of a major chord (semitones)
+*/
+static const int8_t g_acArpMajor[] = {0, 4, 7};
+
+/*!
+Arpeggio, that runs below the played note (semitones)
+*/
+static const int8_t g_acArpDown[] = {0, -12, -24};
+
+/*!
+Instruments of the scenario "voice": lead (ADSR + vibrato), chord (arpeggio)
+and bass (portamento)
+*/
+static const psginstr_t g_tLead  = {0x40, 0x08, 10, 0x10, 6, 24, 10, 0, NULL, 0};
+static const psginstr_t g_tChord = {0xF0, 0x04, 8, 0x20, 0, 0, 0, 0, g_acArpMajor, 3};
+static const psginstr_t g_tBass  = {0x00, 0x00, 15, 0x08, 0, 0, 0, 8, g_acArpDown, 3};
+
+/*!
+Instrument of the scenario "bend": constant level, no modulation
+*/
+static const psginstr_t g_tPad   = {0x00, 0x00, 15, 0x00, 0, 0, 0, 0, NULL, 0};
+
+/*!
+Snapshots of the scenario "crossfade": music (tone on A and B) and jingle
+(envelope on C, noise on A)
+*/
+static const psgsnapshot_t g_tMusic =
+{
+  {0xAC, 0x01, 0x1C, 0x01, 0x00, 0x00, 0x00, (uint8_t) ~(PSG_MIXER_TONE_A | PSG_MIXER_TONE_B),
+   0x0F, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}
+};
+
+static const psgsnapshot_t g_tJingle =
+{
+  {0x00, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x08, (uint8_t) ~(PSG_MIXER_NOISE_A | PSG_MIXER_TONE_C),
+   0x0A, 0x00, PSG_AMPL_ENVELOPE, 0x40, 0x03, PSG_ENV_SHAPE_CONTINUE | PSG_ENV_SHAPE_ALTERNATE, 0x00, 0x00}
+};
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+/*!
+Current frame of the scenario (time stamp of the traced writes)
+*/
+static uint32_t g_uiFrame;
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+/*!
+Scenario, that is played through libpsg
+*/
+typedef struct _scene
+{
+  const char* acName;
+  void (*fnPlay)(psgstate_t* pState);
+} scene_t;
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+/*!
+Advance the time stamp of the traced writes.
+@param uiFrames Number of frames to wait
+*/
+static void psgscene_wait(uint32_t uiFrames);
+
+/*!
+Scenarios; every scenario uses the opened PSG 0.
+@param pState Pointer to device structure
+*/
+static void psgscene_tone(psgstate_t* pState);
+static void psgscene_noise(psgstate_t* pState);
+static void psgscene_envelope(psgstate_t* pState);
+static void psgscene_voice(psgstate_t* pState);
+static void psgscene_bend(psgstate_t* pState);
+static void psgscene_crossfade(psgstate_t* pState);
+static void psgscene_core_ay(psgstate_t* pState);
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* main()                                                                     */
+/*----------------------------------------------------------------------------*/
+int main(int argc, char* argv[])
+{
+  static const scene_t tScene[] =
+  {
+    {"tone",      psgscene_tone},
+    {"noise",     psgscene_noise},
+    {"envelope",  psgscene_envelope},
+    {"voice",     psgscene_voice},
+    {"bend",      psgscene_bend},
+    {"crossfade", psgscene_crossfade},
+    {"core_ay",   psgscene_core_ay}
+  };
+
+  psgstate_t tState;
+  FILE* pTrace;
+
+  if ((2 == argc) && (0 == strcmp(argv[1], "-l")))
+  {
+    for (size_t i = 0; i < PSGSCENE_COUNT(tScene); ++i)
+    {
+      puts(tScene[i].acName);
+    }
+
+    return EOK;
+  }
+
+  if (3 != argc)
+  {
+    fputs(g_acUsage, stderr);
+    return 2;
+  }
+
+  for (size_t i = 0; i < PSGSCENE_COUNT(tScene); ++i)
+  {
+    if (0 == strcmp(argv[1], tScene[i].acName))
+    {
+      if (!(pTrace = fopen(argv[2], "w")))
+      {
+        perror(argv[2]);
+        return 2;
+      }
+
+      psgsim_reset(PSGSIM_DEFAULT_RATE);
+      psgsim_trace(pTrace);
+      psgscene_wait(0);
+
+      psg_set_mode(PSG_MODE_SINGLE);
+      psg_set_stereo_mode(PSG_STEREO_ABC);
+      psg_open(&tState, 0);
+      psg_set_mono_mode(&tState, PSG_MODE_STEREO);
+
+      tScene[i].fnPlay(&tState);
+
+      psg_set_mixer(&tState, 0);
+      psg_close(&tState);
+
+      psgsim_trace(NULL);
+      fclose(pTrace);
+      return EOK;
+    }
+  }
+
+  fprintf(stderr, "%s: unknown scenario\n", argv[1]);
+  return 2;
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgscene_wait()                                                            */
+/*----------------------------------------------------------------------------*/
+static void psgscene_wait(uint32_t uiFrames)
+{
+  g_uiFrame = (uiFrames ? g_uiFrame + uiFrames : 0);
+  psgsim_frame(g_uiFrame);
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgscene_tone()                                                            */
+/*----------------------------------------------------------------------------*/
+static void psgscene_tone(psgstate_t* pState)
+{
+  psg_set_core(PSG_CORE_YM);
+  psg_set_tone_period(pState, PSG_CHANNEL_A, psg_calc_tone_period(PSG_FREQ_C4));
+  psg_set_tone_period(pState, PSG_CHANNEL_B, psg_calc_tone_period(PSG_FREQ_E4));
+  psg_set_tone_period(pState, PSG_CHANNEL_C, psg_calc_tone_period(PSG_FREQ_G4));
+  psg_set_amplitude(pState, PSG_CHANNEL_A, 15);
+  psg_set_amplitude(pState, PSG_CHANNEL_B, 12);
+  psg_set_amplitude(pState, PSG_CHANNEL_C, 10);
+  psg_set_mixer(pState, PSG_MIXER_TONE_A | PSG_MIXER_TONE_B | PSG_MIXER_TONE_C);
+  psgscene_wait(20);
+
+  psg_set_tone_period(pState, PSG_CHANNEL_A, psg_calc_tone_period(PSG_FREQ_A4));
+  psg_set_tone_period(pState, PSG_CHANNEL_C, psg_calc_tone_period(PSG_FREQ_C5));
+  psgscene_wait(20);
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgscene_noise()                                                           */
+/*----------------------------------------------------------------------------*/
+static void psgscene_noise(psgstate_t* pState)
+{
+  static const uint16_t uiFreq[] = {4000, 8000, 16000, 40000};
+
+  psg_set_core(PSG_CORE_YM);
+  psg_set_tone_period(pState, PSG_CHANNEL_B, psg_calc_tone_period(PSG_FREQ_D4));
+  psg_set_amplitude(pState, PSG_CHANNEL_A, 15);
+  psg_set_amplitude(pState, PSG_CHANNEL_B, 8);
+  psg_set_mixer(pState, PSG_MIXER_NOISE_A | PSG_MIXER_TONE_B);
+
+  for (size_t i = 0; i < PSGSCENE_COUNT(uiFreq); ++i)
+  {
+    psg_set_noise_period(pState, psg_calc_noise_period(uiFreq[i]));
+    psgscene_wait(10);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgscene_envelope()                                                        */
+/*----------------------------------------------------------------------------*/
+static void psgscene_envelope(psgstate_t* pState)
+{
+  psg_set_core(PSG_CORE_YM);
+  psg_set_tone_period(pState, PSG_CHANNEL_A, psg_calc_tone_period(PSG_FREQ_A4));
+  psg_set_amplitude(pState, PSG_CHANNEL_A, PSG_AMPL_ENVELOPE);
+  psg_set_mixer(pState, PSG_MIXER_TONE_A);
+
+  /* triangle with 250 ms per ramp */
+  psg_set_envelope_period(pState, psg_calc_envelope_period_ms(250));
+  psg_set_envelope_shape(pState, PSG_ENV_SHAPE_CONTINUE | PSG_ENV_SHAPE_ALTERNATE);
+  psgscene_wait(30);
+
+  /* saw tooth with 8 Hz */
+  psg_set_envelope_period(pState, psg_calc_envelope_period(8));
+  psg_set_envelope_shape(pState, PSG_ENV_SHAPE_CONTINUE);
+  psgscene_wait(20);
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgscene_voice()                                                           */
+/*----------------------------------------------------------------------------*/
+static void psgscene_voice(psgstate_t* pState)
+{
+  psgvoice_t tVoice[3];
+
+  psg_set_core(PSG_CORE_YM);
+  psg_voice_init(&tVoice[0], PSG_CHANNEL_A);
+  psg_voice_init(&tVoice[1], PSG_CHANNEL_B);
+  psg_voice_init(&tVoice[2], PSG_CHANNEL_C);
+  psg_voice_set_instrument(&tVoice[0], &g_tLead);
+  psg_voice_set_instrument(&tVoice[1], &g_tChord);
+  psg_voice_set_instrument(&tVoice[2], &g_tBass);
+  psg_set_mixer(pState, PSG_MIXER_TONE_A | PSG_MIXER_TONE_B | PSG_MIXER_TONE_C);
+
+  psg_voice_note_on(&tVoice[0], PSG_NOTE(5, PSG_NOTE_E));
+  psg_voice_note_on(&tVoice[1], PSG_NOTE(4, PSG_NOTE_C));
+  psg_voice_note_on(&tVoice[2], PSG_NOTE(2, PSG_NOTE_C));
+
+  for (uint8_t i = 0; i < 60; ++i)
+  {
+    switch (i)
+    {
+      case 15:
+        /* portamento from C2 and arpeggio below note 0 */
+        psg_voice_note_on(&tVoice[2], PSG_NOTE(1, PSG_NOTE_D));
+        break;
+
+      case 25:
+        psg_voice_note_on(&tVoice[0], PSG_NOTE(5, PSG_NOTE_G));
+        psg_voice_bend(&tVoice[1], -2);
+        break;
+
+      case 40:
+        psg_voice_note_off(&tVoice[0]);
+        psg_voice_note_off(&tVoice[1]);
+        psg_voice_note_off(&tVoice[2]);
+        break;
+
+      default:
+        break;
+    }
+
+    psg_voice_tick(pState, tVoice, 3);
+    psgscene_wait(1);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgscene_bend()                                                            */
+/*----------------------------------------------------------------------------*/
+static void psgscene_bend(psgstate_t* pState)
+{
+  static const int8_t iStep[] = {127, -127};
+  psgvoice_t tVoice;
+
+  psg_set_core(PSG_CORE_YM);
+  psg_voice_init(&tVoice, PSG_CHANNEL_A);
+  psg_voice_set_instrument(&tVoice, &g_tPad);
+  psg_set_mixer(pState, PSG_MIXER_TONE_A);
+
+  /* bends held for 300 ticks (5 ticks per frame) saturate at the limits */
+  for (uint8_t i = 0; i < sizeof(iStep); ++i)
+  {
+    psg_voice_note_on(&tVoice, PSG_NOTE(4, PSG_NOTE_A));
+    psg_voice_bend(&tVoice, iStep[i]);
+
+    for (uint8_t j = 0; j < 60; ++j)
+    {
+      for (uint8_t k = 0; k < 5; ++k)
+      {
+        psg_voice_tick(pState, &tVoice, 1);
+      }
+
+      psgscene_wait(1);
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgscene_crossfade()                                                       */
+/*----------------------------------------------------------------------------*/
+static void psgscene_crossfade(psgstate_t* pState)
+{
+  psgfade_t tFade;
+
+  psg_set_core(PSG_CORE_YM);
+  psg_restore(pState, &g_tMusic);
+  psgscene_wait(10);
+
+  psg_crossfade_start(&tFade, pState, &g_tMusic, &g_tJingle, 20);
+
+  while (psg_crossfade_tick(&tFade))
+  {
+    psgscene_wait(1);
+  }
+
+  psgscene_wait(15);
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgscene_core_ay()                                                         */
+/*----------------------------------------------------------------------------*/
+static void psgscene_core_ay(psgstate_t* pState)
+{
+  psg_set_core(PSG_CORE_AY);
+  psg_set_tone_period(pState, PSG_CHANNEL_A, psg_calc_tone_period(PSG_FREQ_C4));
+  psg_set_tone_period(pState, PSG_CHANNEL_C, psg_calc_tone_period(PSG_FREQ_G4));
+  psg_set_amplitude(pState, PSG_CHANNEL_A, 13);
+  psg_set_amplitude(pState, PSG_CHANNEL_C, PSG_AMPL_ENVELOPE);
+  psg_set_mixer(pState, PSG_MIXER_TONE_A | PSG_MIXER_TONE_C);
+
+  /* decay with 400 ms, repeated */
+  psg_set_envelope_period(pState, psg_calc_envelope_period_ms(400));
+  psg_set_envelope_shape(pState, PSG_ENV_SHAPE_CONTINUE);
+  psgscene_wait(40);
+
+  /* same sound with the YM2149 */
+  psg_set_core(PSG_CORE_YM);
+  psgscene_wait(40);
+}
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,590 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: psgsim.c                                                           |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Host (Linux) simulation of the PSGs (AY-3-8912/YM2149) of the ZX Spectrum Next|
+| and port layer for libpsg (replaces psg_write_reg.c, psg_read_reg.c and      |
+| psg_calc_period.asm)                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <arch/zxn.h>
+#include "libpsg.h"
+#include "psg_internal.h"
+#include "psgsim.h"
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+/*!
+Mask of the valid bits of all registers of a PSG
+*/
+#define PSGSIM_REG_MASK { 0xFF, 0x0F, 0xFF, 0x0F, 0xFF, 0x0F, 0x1F, 0xFF, \
+                          0x1F, 0x1F, 0x1F, 0xFF, 0xFF, 0x0F, 0xFF, 0xFF }
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+/*!
+Valid bits of all registers of a PSG
+*/
+static const uint8_t g_uiRegMask[PSGSIM_REGS] = PSGSIM_REG_MASK;
+
+/*!
+Volume curve of the AY-3-8912 (16 levels, each used for two envelope steps)
+*/
+static const double g_dAyVolume[16] =
+{
+  0.0,               0.00999465934234, 0.0144502937362,  0.0210574502174,
+  0.0307011520562,   0.0455481803616,  0.0644998855573,  0.107362478065,
+  0.126588845655,    0.20498970016,    0.292210269322,   0.372838941024,
+  0.492530708782,    0.635324635691,   0.805584802014,   1.0
+};
+
+/*!
+Volume curve of the YM2149 (32 levels)
+*/
+static const double g_dYmVolume[32] =
+{
+  0.0,               0.0,              0.00465400167849, 0.00772106507973,
+  0.0109559777218,   0.0139620050355,  0.0169985503929,  0.0200198367285,
+  0.024368657969,    0.029694056611,   0.0350652323186,  0.0403906309606,
+  0.0485389486534,   0.0583352407111,  0.0680552376593,  0.0777752346075,
+  0.0925154497597,   0.111085679408,   0.129747463188,   0.148485542077,
+  0.17666895552,     0.211551079576,   0.246387426566,   0.281101701381,
+  0.333730067903,    0.400427252613,   0.467383840696,   0.53443198291,
+  0.635172045472,    0.75800717174,    0.879926756695,   1.0
+};
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+/*!
+State of the simulation
+*/
+static psgsim_t g_tSim;
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+/*!
+Advance all generators of a sound generator by one tick (8 clocks).
+@param pChip Pointer to the sound generator
+*/
+static void psgsim_tick(psgsimchip_t* pChip);
+
+/*!
+Restart the envelope generator (after a write to register 13).
+@param pChip Pointer to the sound generator
+*/
+static void psgsim_env_restart(psgsimchip_t* pChip);
+
+/*!
+Write a 32-bit value in little endian byte order.
+@param pFile Opened binary file
+@param uiValue Value to write
+@param uiSize Number of bytes to write (2 or 4)
+*/
+static void psgsim_put_le(FILE* pFile, uint32_t uiValue, uint8_t uiSize);
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* psg_write_reg()                                                            */
+/*----------------------------------------------------------------------------*/
+void psg_write_reg(psgstate_t* pState, uint8_t uiReg, uint8_t uiValue)
+{
+  if (pState)
+  {
+    psgsim_write(pState->uiIndex & 0x03, uiReg, uiValue);
+
+   #if defined(__PSG_USE_REG_LATCH__)
+    pState->uiReg[uiReg] = uiValue;
+   #endif
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/* psg_read_reg()                                                             */
+/*----------------------------------------------------------------------------*/
+uint8_t psg_read_reg(psgstate_t* pState, uint8_t uiReg)
+{
+  if (pState)
+  {
+   #if defined(__PSG_USE_REG_LATCH__)
+    return pState->uiReg[uiReg];
+   #else
+    return g_tSim.tChip[pState->uiIndex % PSGSIM_CHIPS].uiReg[uiReg & 0x0F];
+   #endif
+  }
+
+  return 0xFF;
+}
+
+/*----------------------------------------------------------------------------*/
+/* psg_write_block_callee()                                                   */
+/*----------------------------------------------------------------------------*/
+void psg_write_block_callee(const uint8_t* pValues, uint8_t uiFirst, uint8_t uiCount, uint8_t uiIndex)
+{
+  while (uiCount--)
+  {
+    psgsim_write(uiIndex & 0x03, uiFirst++, *pValues++);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/* psg_calc_period_callee()                                                   */
+/*----------------------------------------------------------------------------*/
+uint32_t psg_calc_period_callee(uint16_t uiDivisor, const uint32_t* pRecip)
+{
+  return psgsim_calc_period(uiDivisor, pRecip, 0);
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgsim_calc_period()                                                       */
+/*----------------------------------------------------------------------------*/
+uint32_t psgsim_calc_period(uint16_t uiDivisor, const uint32_t* pRecip, uint8_t* pCorrections)
+{
+  uint32_t uiDiff;
+  uint16_t uiQuot;
+  uint8_t  uiShift;
+  uint8_t  uiNorm;
+
+  if (pCorrections)
+  {
+    *pCorrections = 0;
+  }
+
+  if (uiDivisor < 0x100)
+  {
+    /* lo_norm: shift the divisor into m = 128 .. 255; B = index of the msb */
+    uiNorm  = (uint8_t) uiDivisor;
+    uiShift = 7;
+
+    while (!(uiNorm & 0x80))
+    {
+      uiNorm <<= 1;
+      --uiShift;
+    }
+
+    /* lo_found: 24 bit entry A:HL, shifted right by B */
+    return (pRecip[uiNorm & 0x7F] & UINT32_C(0x00FFFFFF)) >> uiShift;
+  }
+
+  /* hi_norm: m = upper 8 bits of the divisor; B = number of shifts - 1 */
+  uiShift = 0;
+
+  while ((uiDivisor >> (uiShift + 1)) > 0xFF)
+  {
+    ++uiShift;
+  }
+
+  uiNorm = (uint8_t) (uiDivisor >> (uiShift + 1));
+
+  /* hi_found: DE = (entry >> 8) >> B (bsrl de, b) */
+  uiQuot = (uint16_t) (((pRecip[uiNorm & 0x7F] >> 8) & 0xFFFF) >> uiShift);
+
+  /* A:DE = q * uiDivisor - pRecip[0] - 1 (24 bit) */
+  uiDiff = (((uint32_t) uiQuot * uiDivisor) - pRecip[0] - 1) & UINT32_C(0x00FFFFFF);
+
+  /* hi_corr: while (A:DE >= 0) { --q; A:DE -= uiDivisor; } */
+  while (!(uiDiff & UINT32_C(0x00800000)))
+  {
+    --uiQuot;
+    uiDiff = (uiDiff - uiDivisor) & UINT32_C(0x00FFFFFF);
+
+    if (pCorrections)
+    {
+      ++*pCorrections;
+    }
+  }
+
+  return uiQuot;
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgsim_reset()                                                             */
+/*----------------------------------------------------------------------------*/
+void psgsim_reset(uint32_t uiRate)
+{
+  FILE* pTrace = g_tSim.pTrace;
+
+  memset(&g_tSim, 0, sizeof(g_tSim));
+  g_tSim.uiRate = (uiRate ? uiRate : PSGSIM_DEFAULT_RATE);
+  g_tSim.pTrace = pTrace;
+
+  for (uint8_t i = 0; i < PSGSIM_CHIPS; ++i)
+  {
+    g_tSim.tChip[i].uiNoiseLfsr = 1;
+    g_tSim.tChip[i].uiReg[AY8912_REG_MIXER] = 0xFF;
+    psgsim_env_restart(&g_tSim.tChip[i]);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgsim_trace()                                                             */
+/*----------------------------------------------------------------------------*/
+void psgsim_trace(FILE* pFile)
+{
+  g_tSim.pTrace = pFile;
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgsim_apply()                                                             */
+/*----------------------------------------------------------------------------*/
+long psgsim_apply(const char* acLine)
+{
+  unsigned long uiFrame;
+  unsigned int uiChip;
+  int iReg, iValue;
+
+  if (4 == sscanf(acLine, " W %lu %u %i %i", &uiFrame, &uiChip, &iReg, &iValue))
+  {
+    g_tSim.uiFrame = uiFrame;
+    psgsim_write((uint8_t) uiChip, (uint8_t) iReg, (uint8_t) iValue);
+    return (long) uiFrame;
+  }
+
+  if (3 == sscanf(acLine, " N %lu %i %i", &uiFrame, &iReg, &iValue))
+  {
+    g_tSim.uiFrame = uiFrame;
+    psgsim_nreg_write((uint8_t) iReg, (uint8_t) iValue);
+    return (long) uiFrame;
+  }
+
+  return -1;
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgsim_frame()                                                             */
+/*----------------------------------------------------------------------------*/
+void psgsim_frame(uint32_t uiFrame)
+{
+  g_tSim.uiFrame = uiFrame;
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgsim_write()                                                             */
+/*----------------------------------------------------------------------------*/
+void psgsim_write(uint8_t uiChip, uint8_t uiReg, uint8_t uiValue)
+{
+  if ((PSGSIM_CHIPS > uiChip) && (PSGSIM_REGS > uiReg))
+  {
+    psgsimchip_t* pChip = &g_tSim.tChip[uiChip];
+
+    pChip->uiReg[uiReg] = uiValue & g_uiRegMask[uiReg];
+
+    if (AY8912_REG_ENV_SHAPE == uiReg)
+    {
+      psgsim_env_restart(pChip);
+    }
+
+    if (g_tSim.pTrace)
+    {
+      fprintf(g_tSim.pTrace, "W %lu %u %u 0x%02X\n",
+              (unsigned long) g_tSim.uiFrame, uiChip, uiReg, uiValue);
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgsim_nreg_read()                                                         */
+/*----------------------------------------------------------------------------*/
+uint8_t psgsim_nreg_read(uint8_t uiReg)
+{
+  return g_tSim.uiNReg[uiReg];
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgsim_nreg_write()                                                        */
+/*----------------------------------------------------------------------------*/
+void psgsim_nreg_write(uint8_t uiReg, uint8_t uiValue)
+{
+  g_tSim.uiNReg[uiReg] = uiValue;
+
+  if (g_tSim.pTrace)
+  {
+    fprintf(g_tSim.pTrace, "N %lu 0x%02X 0x%02X\n",
+            (unsigned long) g_tSim.uiFrame, uiReg, uiValue);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgsim_render()                                                            */
+/*----------------------------------------------------------------------------*/
+void psgsim_render(int16_t* pBuffer, uint32_t uiFrames)
+{
+  const uint8_t uiCore   = psgsim_nreg_read(REG_PERIPHERAL_2) & 0x03;
+  const uint8_t uiChips  = (psgsim_nreg_read(REG_PERIPHERAL_3) & RP3_ENABLE_TURBOSOUND) ? PSGSIM_CHIPS : 1;
+  const uint8_t uiACB    = (psgsim_nreg_read(REG_PERIPHERAL_3) >> 5) & 0x01;
+  const uint8_t uiMono   = psgsim_nreg_read(REG_PERIPHERAL_4) >> 5;
+
+  for (uint32_t uiFrame = 0; uiFrame < uiFrames; ++uiFrame)
+  {
+    double dLeft  = 0.0;
+    double dRight = 0.0;
+    uint32_t uiTicks = 0;
+
+    g_tSim.uiPhase += PSGSIM_TICK_RATE;
+
+    while (g_tSim.uiPhase >= g_tSim.uiRate)
+    {
+      g_tSim.uiPhase -= g_tSim.uiRate;
+      ++uiTicks;
+
+      for (uint8_t i = 0; i < uiChips; ++i)
+      {
+        psgsimchip_t* pChip = &g_tSim.tChip[i];
+        double dLevel[3];
+
+        psgsim_tick(pChip);
+
+        if (PSG_CORE_RST == uiCore)
+        {
+          continue;
+        }
+
+        for (uint8_t c = 0; c < 3; ++c)
+        {
+          const uint8_t uiMixer = pChip->uiReg[AY8912_REG_MIXER];
+          const uint8_t uiAmpl  = pChip->uiReg[AY8912_REG_CHN_A_AMPL + c];
+          const uint8_t uiOut   = (pChip->uiTone[c] | ((uiMixer >> c) & 0x01)) &
+                                  ((pChip->uiNoiseLfsr & 0x01) | ((uiMixer >> (c + 3)) & 0x01));
+
+          /* 32 step index: fixed amplitudes use the odd steps */
+          const uint8_t uiStep = (uiAmpl & PSG_AMPL_ENVELOPE) ? pChip->uiEnvLevel : (((uiAmpl & 0x0F) << 1) | 0x01);
+
+          if (PSG_CORE_YM == uiCore)
+          {
+            dLevel[c] = uiOut ? g_dYmVolume[uiStep] : 0.0;
+          }
+          else
+          {
+            dLevel[c] = uiOut ? g_dAyVolume[uiStep >> 1] : 0.0;
+          }
+        }
+
+        if (uiMono & (1 << i))
+        {
+          dLeft  += dLevel[0] + dLevel[1] + dLevel[2];
+          dRight += dLevel[0] + dLevel[1] + dLevel[2];
+        }
+        else
+        {
+          /* ABC: A = left, B = both, C = right; ACB: A = left, C = both, B = right */
+          const uint8_t uiMid = uiACB ? 2 : 1;
+          const uint8_t uiRgt = uiACB ? 1 : 2;
+          dLeft  += dLevel[0] + dLevel[uiMid];
+          dRight += dLevel[uiRgt] + dLevel[uiMid];
+        }
+      }
+    }
+
+    if (uiTicks)
+    {
+      /* box filter over all ticks of the sample; 3 chips x 3 channels fit */
+      dLeft  *= 32767.0 / (9.0 * uiTicks);
+      dRight *= 32767.0 / (9.0 * uiTicks);
+    }
+
+    pBuffer[(uiFrame << 1) + 0] = (int16_t) dLeft;
+    pBuffer[(uiFrame << 1) + 1] = (int16_t) dRight;
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgsim_wav_header()                                                        */
+/*----------------------------------------------------------------------------*/
+void psgsim_wav_header(FILE* pFile, uint32_t uiRate, uint32_t uiFrames)
+{
+  const uint32_t uiData = uiFrames * 2 * sizeof(int16_t);
+
+  fwrite("RIFF", 1, 4, pFile);
+  psgsim_put_le(pFile, 36 + uiData, 4);
+  fwrite("WAVEfmt ", 1, 8, pFile);
+  psgsim_put_le(pFile, 16, 4);                                   /* fmt size */
+  psgsim_put_le(pFile, 1, 2);                                         /* PCM */
+  psgsim_put_le(pFile, 2, 2);                                      /* stereo */
+  psgsim_put_le(pFile, uiRate, 4);
+  psgsim_put_le(pFile, uiRate * 2 * sizeof(int16_t), 4);       /* bytes/sec */
+  psgsim_put_le(pFile, 2 * sizeof(int16_t), 2);                /* alignment */
+  psgsim_put_le(pFile, 16, 2);                                /* bits/sample */
+  fwrite("data", 1, 4, pFile);
+  psgsim_put_le(pFile, uiData, 4);
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgsim_wav_read()                                                          */
+/*----------------------------------------------------------------------------*/
+int16_t* psgsim_wav_read(FILE* pFile, uint32_t* puiRate, uint32_t* puiFrames)
+{
+  uint8_t uiHeader[44];
+
+  if ((sizeof(uiHeader) == fread(uiHeader, 1, sizeof(uiHeader), pFile)) &&
+      (0 == memcmp(uiHeader, "RIFF", 4)) && (0 == memcmp(&uiHeader[36], "data", 4)))
+  {
+    const uint32_t uiData = uiHeader[40] | (uiHeader[41] << 8) | (uiHeader[42] << 16) | ((uint32_t) uiHeader[43] << 24);
+    int16_t* pSamples = malloc(uiData ? uiData : 1);
+
+    *puiRate   = uiHeader[24] | (uiHeader[25] << 8) | (uiHeader[26] << 16) | ((uint32_t) uiHeader[27] << 24);
+    *puiFrames = uiData / (2 * sizeof(int16_t));
+
+    if (pSamples && (uiData == fread(pSamples, 1, uiData, pFile)))
+    {
+      for (uint32_t i = 0; i < (*puiFrames << 1); ++i)
+      {
+        const uint8_t* pRaw = (const uint8_t*) &pSamples[i];
+        pSamples[i] = (int16_t) (pRaw[0] | (pRaw[1] << 8));
+      }
+
+      return pSamples;
+    }
+
+    free(pSamples);
+  }
+
+  return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgsim_tick()                                                              */
+/*----------------------------------------------------------------------------*/
+static void psgsim_tick(psgsimchip_t* pChip)
+{
+  /* tone generators: output toggles every "period" ticks */
+  for (uint8_t c = 0; c < 3; ++c)
+  {
+    uint16_t uiPeriod = pChip->uiReg[AY8912_REG_CHN_A_FINE + (c << 1)] |
+                        (pChip->uiReg[AY8912_REG_CHN_A_COARSE + (c << 1)] << 8);
+
+    if (++pChip->uiToneCnt[c] >= (uiPeriod ? uiPeriod : 1))
+    {
+      pChip->uiToneCnt[c] = 0;
+      pChip->uiTone[c] ^= 0x01;
+    }
+  }
+
+  /* noise generator: 17 bit LFSR, shifted with half of the tick rate */
+  pChip->uiNoiseDiv ^= 0x01;
+
+  if (pChip->uiNoiseDiv)
+  {
+    const uint8_t uiPeriod = pChip->uiReg[AY8912_REG_NOISE_PERIOD];
+
+    if (++pChip->uiNoiseCnt >= (uiPeriod ? uiPeriod : 1))
+    {
+      pChip->uiNoiseCnt = 0;
+      pChip->uiNoiseLfsr = (pChip->uiNoiseLfsr >> 1) |
+                           (((pChip->uiNoiseLfsr ^ (pChip->uiNoiseLfsr >> 3)) & 0x01) << 16);
+    }
+  }
+
+  /* envelope generator: 32 steps per cycle */
+  if (!pChip->uiEnvHold)
+  {
+    const uint16_t uiPeriod = pChip->uiReg[AY8912_REG_ENV_FINE] | (pChip->uiReg[AY8912_REG_ENV_COARSE] << 8);
+
+    if (++pChip->uiEnvCnt >= (uiPeriod ? uiPeriod : 1))
+    {
+      const uint8_t uiShape = pChip->uiReg[AY8912_REG_ENV_SHAPE];
+
+      pChip->uiEnvCnt = 0;
+
+      if (32 <= ++pChip->uiEnvStep)
+      {
+        pChip->uiEnvStep = 0;
+
+        if (!(uiShape & PSG_ENV_SHAPE_CONTINUE))
+        {
+          pChip->uiEnvHold  = 1;
+          pChip->uiEnvLevel = 0;
+          return;
+        }
+        else if (uiShape & PSG_ENV_SHAPE_HOLD)
+        {
+          /* final value of the first cycle; inverted if "alternate" */
+          pChip->uiEnvHold  = 1;
+          pChip->uiEnvLevel = (pChip->uiEnvAttack ? 31 : 0) ^ ((uiShape & PSG_ENV_SHAPE_ALTERNATE) ? 31 : 0);
+          return;
+        }
+        else if (uiShape & PSG_ENV_SHAPE_ALTERNATE)
+        {
+          pChip->uiEnvAttack ^= 0x01;
+        }
+      }
+
+      pChip->uiEnvLevel = pChip->uiEnvAttack ? pChip->uiEnvStep : (31 - pChip->uiEnvStep);
+    }
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgsim_env_restart()                                                       */
+/*----------------------------------------------------------------------------*/
+static void psgsim_env_restart(psgsimchip_t* pChip)
+{
+  pChip->uiEnvCnt    = 0;
+  pChip->uiEnvStep   = 0;
+  pChip->uiEnvHold   = 0;
+  pChip->uiEnvAttack = (pChip->uiReg[AY8912_REG_ENV_SHAPE] & PSG_ENV_SHAPE_ATTACK) ? 1 : 0;
+  pChip->uiEnvLevel  = pChip->uiEnvAttack ? 0 : 31;
+}
+
+/*----------------------------------------------------------------------------*/
+/* psgsim_put_le()                                                            */
+/*----------------------------------------------------------------------------*/
+static void psgsim_put_le(FILE* pFile, uint32_t uiValue, uint8_t uiSize)
+{
+  for (uint8_t i = 0; i < uiSize; ++i)
+  {
+    fputc((int) ((uiValue >> (i << 3)) & 0xFF), pFile);
+  }
+}
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,284 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: psgsim.h                                                           |
+| project:  ZX Spectrum Next - libdrv                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Host (Linux) simulation of the PSGs (AY-3-8912/YM2149) of the ZX Spectrum Next|
+| for regression tests and benchmarks of libpsg                                |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__PSGSIM_H__)
+  #define __PSGSIM_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdio.h>
+
+/*============================================================================*/
+/*                               Macros                                       */
+/*============================================================================*/
+/*!
+Number of simulated sound generators (Turbosound: 3 x AY-3-8912)
+*/
+#define PSGSIM_CHIPS (3)
+
+/*!
+Number of registers of a sound generator
+*/
+#define PSGSIM_REGS (16)
+
+/*!
+Rate of the internal generator ticks in [Hz] (PSG_CLOCK / 8)
+*/
+#define PSGSIM_TICK_RATE (PSG_CLOCK / 8)
+
+/*!
+Default sample rate of the rendered audio data in [Hz]
+*/
+#define PSGSIM_DEFAULT_RATE (44100)
+
+/*!
+Default rate of the frames (interrupts) of the ZX Spectrum Next in [Hz]
+*/
+#define PSGSIM_DEFAULT_FPS (50)
+
+/*============================================================================*/
+/*                               Constants                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variables                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Structures                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitions                              */
+/*============================================================================*/
+/*!
+State of a single simulated sound generator.
+*/
+typedef struct _psgsimchip
+{
+  /*!
+  Contents of all registers
+  */
+  uint8_t uiReg[PSGSIM_REGS];
+
+  /*!
+  Counters of the tone generators (A, B, C)
+  */
+  uint16_t uiToneCnt[3];
+
+  /*!
+  Outputs of the tone generators (A, B, C)
+  */
+  uint8_t uiTone[3];
+
+  /*!
+  Counter of the noise generator
+  */
+  uint16_t uiNoiseCnt;
+
+  /*!
+  Prescaler of the noise generator (noise runs with half the tone rate)
+  */
+  uint8_t uiNoiseDiv;
+
+  /*!
+  Shift register (17 bit) of the noise generator
+  */
+  uint32_t uiNoiseLfsr;
+
+  /*!
+  Counter of the envelope generator
+  */
+  uint16_t uiEnvCnt;
+
+  /*!
+  Current step within a cycle of the envelope (0 .. 31)
+  */
+  uint8_t uiEnvStep;
+
+  /*!
+  Current direction of the envelope: "1" = attack; "0" = decay
+  */
+  uint8_t uiEnvAttack;
+
+  /*!
+  If not "0", the envelope holds "uiEnvLevel"
+  */
+  uint8_t uiEnvHold;
+
+  /*!
+  Current output level of the envelope (0 .. 31)
+  */
+  uint8_t uiEnvLevel;
+} psgsimchip_t;
+
+/*!
+State of the complete simulation (all sound generators, next-registers, trace)
+*/
+typedef struct _psgsim
+{
+  /*!
+  Simulated sound generators
+  */
+  psgsimchip_t tChip[PSGSIM_CHIPS];
+
+  /*!
+  Simulated next-registers (used by "psg_set_core()", "psg_set_mode()", ...)
+  */
+  uint8_t uiNReg[256];
+
+  /*!
+  Sample rate of the rendered audio data in [Hz]
+  */
+  uint32_t uiRate;
+
+  /*!
+  Phase accumulator to convert generator ticks to samples
+  */
+  uint32_t uiPhase;
+
+  /*!
+  Current frame; used as time stamp of all traced register writes
+  */
+  uint32_t uiFrame;
+
+  /*!
+  If not "0", all register writes are traced into this file
+  */
+  FILE* pTrace;
+} psgsim_t;
+
+/*============================================================================*/
+/*                               Prototypes                                   */
+/*============================================================================*/
+/*!
+This function resets the simulation: all registers are cleared, all generators
+are stopped and the frame counter is set to "0".
+@param uiRate Sample rate of the rendered audio data in [Hz]
+*/
+void psgsim_reset(uint32_t uiRate);
+
+/*!
+Enable tracing of all register writes into a text file. Each write of a
+PSG-register creates a line "W <frame> <chip> <reg> <value>", each write of a
+next-register a line "N <frame> <reg> <value>".
+@param pFile Opened text file; "0" = disable tracing
+*/
+void psgsim_trace(FILE* pFile);
+
+/*!
+Apply one line of a trace (see "psgsim_trace()") to the simulation.
+@param acLine Line of the trace
+@return Time stamp (frame) of the line; "-1" = line ignored
+*/
+long psgsim_apply(const char* acLine);
+
+/*!
+Advance the frame counter, that is used as time stamp of traced writes.
+@param uiFrame New frame counter
+*/
+void psgsim_frame(uint32_t uiFrame);
+
+/*!
+C model of the assembler kernel "psg_calc_period" (psg_calc_period.asm): the
+same table lookups, 24 bit products and corrections as on the target.
+@param uiDivisor Divisor (1 .. 65535)
+@param pRecip Table of reciprocals of the dividend (i.e. "g_uiPsgRecipTone")
+@param pCorrections [OUT] Number of corrections of the estimate ("0" = ignored)
+@return floor(pRecip[0] / uiDivisor)
+*/
+uint32_t psgsim_calc_period(uint16_t uiDivisor, const uint32_t* pRecip, uint8_t* pCorrections);
+
+/*!
+Write a value to a register of one of the simulated sound generators
+(equivalent to "psg_write_reg()" on the target).
+@param uiChip Index of the sound generator (0 .. 2)
+@param uiReg Index of the register (0 .. 15)
+@param uiValue Value to write
+*/
+void psgsim_write(uint8_t uiChip, uint8_t uiReg, uint8_t uiValue);
+
+/*!
+Read a next-register of the simulation.
+@param uiReg Index of the next-register
+@return Current value
+*/
+uint8_t psgsim_nreg_read(uint8_t uiReg);
+
+/*!
+Write a next-register of the simulation.
+@param uiReg Index of the next-register
+@param uiValue Value to write
+*/
+void psgsim_nreg_write(uint8_t uiReg, uint8_t uiValue);
+
+/*!
+Render audio data (16 bit, signed, stereo interleaved L/R) from the current
+state of the simulation. The volume curve (AY-3-8912 or YM2149) is selected by
+the core set with "psg_set_core()".
+@param pBuffer Buffer for the samples (2 * uiFrames values)
+@param uiFrames Number of stereo samples to render
+*/
+void psgsim_render(int16_t* pBuffer, uint32_t uiFrames);
+
+/*!
+Write a header of a WAV-file (16 bit, stereo).
+@param pFile Opened binary file (position 0)
+@param uiRate Sample rate in [Hz]
+@param uiFrames Number of stereo samples that follow the header
+*/
+void psgsim_wav_header(FILE* pFile, uint32_t uiRate, uint32_t uiFrames);
+
+/*!
+Read the audio data of a WAV-file that was written by "psgrender".
+@param pFile Opened binary file
+@param puiRate [OUT] Sample rate in [Hz]
+@param puiFrames [OUT] Number of stereo samples
+@return Pointer to the allocated samples (must be freed); "0" on errors
+*/
+int16_t* psgsim_wav_read(FILE* pFile, uint32_t* puiRate, uint32_t* puiFrames);
+
+/*============================================================================*/
+/*                               Implementation                               */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __PSGSIM_H__ */
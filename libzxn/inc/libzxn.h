@@ -132,6 +132,122 @@ Number of the ZXN-register "Layer 1,0 (LoRes) Control" (not defined in <zxn.h>).
 */
 #define REG_L10_CONTROL (0x6A)
 
+/*!
+MMU slot ("0" .. "7"), that is used by the library to page in memory
+temporarily (i.e. the banks of Layer 2). Code, stack and data of the caller must
+not be located in this slot (0x6000 .. 0x7FFF).
+*/
+#define ZXN_PAGE_SLOT (3)
+
+/*!
+Modes of the text output (see "zxn_text_init"):
+- "ZXN_TEXT_32": 32 columns, 8x8 font on the ULA screen (incl. attributes)
+- "ZXN_TEXT_64": 64 columns, 8x8 font on the Timex hi-res screen (512x192)
+- "ZXN_TEXT_85": 85 columns, 6x8 font on the Timex hi-res screen (512x192)
+*/
+#define ZXN_TEXT_32 (0)
+#define ZXN_TEXT_64 (1)
+#define ZXN_TEXT_85 (2)
+
+/*!
+Number of text rows of the ULA/Timex screen
+*/
+#define ZXN_TEXT_ROWS (24)
+
+/*!
+Drawing modes of the graphics primitives (see "zxn_gfx_mode"). The low byte
+selects the pixels to set, the high byte the pixels to toggle:
+"screen = (screen | (pixels & low)) ^ (pixels & high)"
+*/
+#define ZXN_GFX_SET   (0x00FF)
+#define ZXN_GFX_RESET (0xFFFF)
+#define ZXN_GFX_XOR   (0xFF00)
+
+/*!
+Resolutions of Layer 2 (see "zxn_l2_open")
+*/
+#define ZXN_L2_256x192 (0)
+#define ZXN_L2_320x256 (1)
+#define ZXN_L2_640x256 (2)
+
+/*!
+Bank number for "zxn_l2_open": use the bank of the register "Layer 2 Active RAM
+Bank" (0x12) or "Layer 2 Shadow RAM Bank" (0x13)
+*/
+#define ZXN_L2_CURRENT (0xFF)
+
+/*!
+Size of the text console on Layer 2 (256x192, 8x8 font)
+*/
+#define ZXN_CON_COLS (32)
+#define ZXN_CON_ROWS (24)
+
+/*!
+Copper: number of instructions of the copper memory (2K), instruction "HALT"
+(wait for a line, that is never reached) and the start modes
+- "ZXN_COPPER_START": start once at the first instruction
+- "ZXN_COPPER_FRAME": restart at the first instruction in every frame
+*/
+#define ZXN_COPPER_SIZE  (1024)
+#define ZXN_COPPER_HALT  (0xFFFF)
+#define ZXN_COPPER_START (0x40)
+#define ZXN_COPPER_FRAME (0xC0)
+
+/*!
+Palettes: selection of the layer, flag for the second palette of a layer and
+the formats of the colours
+- "ZXN_PAL_8BIT": 1 byte per colour (RRRGGGBB)
+- "ZXN_PAL_9BIT": 2 bytes per colour (RRRGGGBB, 0000000B; in Layer 2 BIT7 of
+                  the second byte is the priority bit)
+*/
+#define ZXN_PAL_ULA     (0x00)
+#define ZXN_PAL_LAYER2  (0x10)
+#define ZXN_PAL_SPRITES (0x20)
+#define ZXN_PAL_TILEMAP (0x30)
+#define ZXN_PAL_SECOND  (0x40)
+#define ZXN_PAL_8BIT    (1)
+#define ZXN_PAL_9BIT    (2)
+#define ZXN_PAL_ENTRIES (256)
+
+/*!
+Palettes: brightness of "zxn_palette_fade" (black .. original colours)
+*/
+#define ZXN_PAL_FADE_MIN (0)
+#define ZXN_PAL_FADE_MAX (8)
+
+/*!
+Hardware sprites: number of sprites, bytes of the attributes of a sprite (all
+sprites use 5 attributes), number of patterns (8 bit) and bytes of a pattern
+*/
+#define ZXN_SPRITES             (128)
+#define ZXN_SPRITE_ATTRS        (5)
+#define ZXN_SPRITE_PATTERNS     (64)
+#define ZXN_SPRITE_PATTERN_SIZE (256)
+
+/*!
+Flags of "zxn_sprite_set" (BIT7:4 = palette offset, see "ZXN_SPRITE_PALETTE")
+*/
+#define ZXN_SPRITE_MIRROR_X  (0x08)
+#define ZXN_SPRITE_MIRROR_Y  (0x04)
+#define ZXN_SPRITE_ROTATE    (0x02)
+#define ZXN_SPRITE_PALETTE(x) (((x) & 0x0F) << 4)
+
+/*!
+Tilemap (Layer 3): sizes, flags of "zxn_tile_open" and size of the dirty list
+- "ZXN_TILE_NOATTR":   1 byte per tile (attribute of all tiles: "uiAttr")
+- "ZXN_TILE_TEXT":     text mode (1 bit per pixel, 8 bytes per tile)
+- "ZXN_TILE_512":      512 tiles (BIT0 of the attribute is BIT8 of the tile)
+- "ZXN_TILE_OVER_ULA": tilemap always over the ULA
+*/
+#define ZXN_TILE_40x32    (0x00)
+#define ZXN_TILE_80x32    (0x40)
+#define ZXN_TILE_NOATTR   (0x20)
+#define ZXN_TILE_TEXT     (0x08)
+#define ZXN_TILE_512      (0x02)
+#define ZXN_TILE_OVER_ULA (0x01)
+#define ZXN_TILE_ROWS     (32)
+#define ZXN_TILE_DIRTY    (128)
+
 /*!
 Stringizing-macros to create version number as string
 */
@@ -152,6 +268,15 @@ This macro delivers the version number of the library as a string literal
 /*============================================================================*/
 /*                               Variablen                                    */
 /*============================================================================*/
+/*!
+Current drawing mode of the graphics primitives ("ZXN_GFX_SET", ...)
+*/
+extern uint16_t g_uiZxnGfxMode;
+
+/*!
+Colours of the ULA (incl. BRIGHT: 8 .. 15) in the default palette of Layer 2
+*/
+extern const uint8_t g_acZxnL2Colour[16];
 
 /*============================================================================*/
 /*                               Strukturen                                   */
@@ -186,6 +311,223 @@ typedef struct _version
   uint8_t uiPatch;
 } version_t;
 
+/*!
+State of the direct text output: cursor, colour and font
+*/
+typedef struct _textstate
+{
+  /*!
+  Mode of the output ("ZXN_TEXT_32", "ZXN_TEXT_64", "ZXN_TEXT_85")
+  */
+  uint8_t uiMode;
+
+  /*!
+  Number of columns of the mode (32, 64, 85)
+  */
+  uint8_t uiCols;
+
+  /*!
+  Cursor position (column, row)
+  */
+  uint8_t uiX;
+  uint8_t uiY;
+
+  /*!
+  Attribute of the characters ("ZXN_TEXT_32" only; in the hi-res modes the
+  colours are selected by port 0xFF)
+  */
+  uint8_t uiAttr;
+
+  /*!
+  Font: 8 bytes per character for the characters 32 .. 127. In mode
+  "ZXN_TEXT_85" the pixels 6 .. 1 of each byte are used (like the ROM font).
+  */
+  const uint8_t* pFont;
+} textstate_t;
+
+/*!
+State of a double-buffered Layer 2: the displayed buffer ("front") and the
+buffer to draw into ("back")
+*/
+typedef struct _layer2
+{
+  /*!
+  Resolution ("ZXN_L2_256x192", "ZXN_L2_320x256", "ZXN_L2_640x256")
+  */
+  uint8_t uiMode;
+
+  /*!
+  Number of 16K-banks of a buffer (3 or 5)
+  */
+  uint8_t uiBanks;
+
+  /*!
+  First 16K-bank of the displayed buffer
+  */
+  uint8_t uiFront;
+
+  /*!
+  First 16K-bank of the back buffer
+  */
+  uint8_t uiBack;
+
+  /*!
+  Internal use only
+  */
+  struct _layer2_priv
+  {
+    uint8_t uiMmu;     /* mapping of slot "ZXN_PAGE_SLOT" before opening */
+    uint8_t uiVBlank;  /* first raster line after the display area */
+  } tPriv;
+} layer2_t;
+
+/*!
+State of the text console on Layer 2 (256x192)
+*/
+typedef struct _console
+{
+  /*!
+  First 16K-bank of the Layer 2
+  */
+  uint8_t uiBank;
+
+  /*!
+  Cursor position (column, row)
+  */
+  uint8_t uiX;
+  uint8_t uiY;
+
+  /*!
+  Colours of the characters and the background (palette indices of Layer 2)
+  */
+  uint8_t uiInk;
+  uint8_t uiPaper;
+
+  /*!
+  Font: 8 bytes per character for the characters 32 .. 127
+  */
+  const uint8_t* pFont;
+
+  /*!
+  Internal use only
+  */
+  struct _console_priv
+  {
+    uint8_t uiTop;  /* row of the buffer, that is displayed at the top */
+  } tPriv;
+} console_t;
+
+/*!
+Copper list, that is built in RAM and uploaded to the copper at once. With two
+buffers the next list can be built while the current one is executed.
+*/
+typedef struct _copper
+{
+  /*!
+  Instructions of the list, that is built (MSB first, like the copper memory)
+  */
+  uint8_t* pList;
+
+  /*!
+  Capacity of a buffer in instructions (max. "ZXN_COPPER_SIZE")
+  */
+  uint16_t uiSize;
+
+  /*!
+  Number of instructions in "pList"
+  */
+  uint16_t uiCount;
+
+  /*!
+  Start mode of the copper ("ZXN_COPPER_FRAME" or "ZXN_COPPER_START")
+  */
+  uint8_t uiMode;
+
+  /*!
+  Internal use only
+  */
+  struct _copper_priv
+  {
+    uint8_t* pBuffer[2];  /* RAM buffers of the lists */
+    uint8_t uiBack;       /* index of the buffer, that is built */
+  } tPriv;
+} copper_t;
+
+/*!
+Shadow of the attribute table of the hardware sprites; the changed sprites are
+uploaded at once by "zxn_sprite_update".
+*/
+typedef struct _spritetable
+{
+  /*!
+  Attributes of all sprites (like the hardware: X, Y, flags, pattern, ext.)
+  */
+  uint8_t acAttr[ZXN_SPRITES][ZXN_SPRITE_ATTRS];
+
+  /*!
+  Internal use only
+  */
+  struct _spritetable_priv
+  {
+    uint8_t uiFirst;  /* first changed sprite */
+    uint8_t uiLast;   /* last changed sprite (< "uiFirst": nothing changed) */
+  } tPriv;
+} spritetable_t;
+
+/*!
+Entry of the dirty list of a tilemap
+*/
+typedef struct _tiledirty
+{
+  uint16_t uiIndex;  /* index of the tile in the map (y * columns + x) */
+  uint8_t  uiTile;
+  uint8_t  uiAttr;
+} tiledirty_t;
+
+/*!
+Tilemap (Layer 3); changes are collected in a dirty list and written into the
+map by "zxn_tile_update" (e.g. in the vertical blank).
+*/
+typedef struct _tilemap
+{
+  /*!
+  Size of the map ("ZXN_TILE_40x32": 40, "ZXN_TILE_80x32": 80)
+  */
+  uint8_t uiCols;
+
+  /*!
+  Flags of "zxn_tile_open"
+  */
+  uint8_t uiFlags;
+
+  /*!
+  Map and tile definitions (bank 5: 0x4000 .. 0x7FFF, 256 bytes aligned)
+  */
+  uint8_t* pMap;
+  uint8_t* pTiles;
+
+  /*!
+  Attribute of the tiles of "zxn_tile_print" (palette offset, mirror, ...)
+  */
+  uint8_t uiAttr;
+
+  /*!
+  Scroll offsets in pixels (X: 0 .. 8 * "uiCols" - 1; Y: 0 .. 255)
+  */
+  uint16_t uiScrollX;
+  uint8_t  uiScrollY;
+
+  /*!
+  Internal use only
+  */
+  struct _tilemap_priv
+  {
+    uint8_t     uiCount;                  /* entries in the dirty list */
+    uint8_t     bScroll;                  /* scroll offsets changed */
+    tiledirty_t acDirty[ZXN_TILE_DIRTY];  /* dirty list */
+  } tPriv;
+} tilemap_t;
+
 /*============================================================================*/
 /*                               Prototypen                                   */
 /*============================================================================*/
@@ -288,12 +630,27 @@ void zxn_border_fastcall(uint8_t uiColor) __preserves_regs(a,b,c,d,e,h,l,iyl,iyh
 #define zxn_border(x) zxn_border_fastcall(x)
 
 /*!
-This function clears the screen
-@param uiColor Color of the background ("paper color")
+This function clears the screen of the current video mode (ULA, Timex
+hi-colour/hi-res, LoRes, Radastan, Layer 2 256x192/320x256/640x256) by the
+zxnDMA. The pixel modes are filled with the paper colour of the attribute (incl.
+BRIGHT) in the default palette of the layer; Layer 2 640x256 (4 bit) is filled
+with the palette index of the paper (0 .. 15), because the first 16 colours of
+the default palette don't contain the colours of the ULA.
+@param uiColor Attribute of the screen (paper colour = background)
+@remark The CPU runs at 28 MHz while the screen is cleared.
 */
 void zxn_cls_fastcall(uint8_t uiColor) __z88dk_fastcall;
 #define zxn_cls(x) zxn_cls_fastcall(x)
 
+/*!
+This function fills a block of memory with a byte by the zxnDMA (fixed source).
+The CPU is halted until the block has been filled.
+@param pDest Pointer to the memory to fill
+@param uiLength Number of bytes to fill
+@param uiValue Value to write
+*/
+void zxn_dma_fill(void* pDest, uint16_t uiLength, uint8_t uiValue);
+
 /*!
 Set the ink color for the next print commands on the screen.
 @param uiColor Color to set ("0" = BLACK ... "7" = WHITE)
@@ -407,6 +764,471 @@ size_t zxn_mem2hex(const void* const pData,
                    size_t uiBufferSize,
                    uint8_t uiGrouping);
 
+/*!
+This function initialises the direct text output. The cursor is set to 0,0
+and the font to the current character set (system variable "CHARS").
+@param pState Pointer to the state of the text output
+@param uiMode Mode of the output ("ZXN_TEXT_32", "ZXN_TEXT_64", "ZXN_TEXT_85")
+@param uiAttr Attribute of the characters
+@return "EOK" = no error
+*/
+uint8_t zxn_text_init(textstate_t* pState, uint8_t uiMode, uint8_t uiAttr);
+
+/*!
+This function sets the cursor of the direct text output.
+@param pState Pointer to the state of the text output
+@param uiX Column (0 .. columns - 1)
+@param uiY Row (0 .. "ZXN_TEXT_ROWS" - 1)
+*/
+void zxn_text_gotoxy(textstate_t* pState, uint8_t uiX, uint8_t uiY);
+
+/*!
+This function writes a string directly into the screen memory at the cursor.
+"\n" moves the cursor to the start of the next line; at the end of a line the
+output wraps, at the end of the screen it continues in the first row.
+The screen address is computed once per line.
+@param pState Pointer to the state of the text output
+@param acText String to write
+*/
+void zxn_text_puts(textstate_t* pState, const char_t* acText);
+
+/*!
+This function writes a single character directly into the screen memory at the
+cursor (see "zxn_text_puts").
+@param pState Pointer to the state of the text output
+@param cChar Character to write
+*/
+void zxn_text_putc(textstate_t* pState, char_t cChar);
+
+/*!
+This function writes a string with the given attribute at the given position
+(see "zxn_text_puts"); the attribute stays selected.
+@param pState Pointer to the state of the text output
+@param uiX Column
+@param uiY Row
+@param uiAttr Attribute of the characters
+@param acText String to write
+*/
+void zxn_print_at(textstate_t* pState, uint8_t uiX, uint8_t uiY, uint8_t uiAttr, const char_t* acText);
+
+/*!
+This function selects the drawing mode of the graphics primitives.
+@param uiMode "ZXN_GFX_SET", "ZXN_GFX_RESET" or "ZXN_GFX_XOR"
+*/
+void zxn_gfx_mode_fastcall(uint16_t uiMode) __z88dk_fastcall;
+#define zxn_gfx_mode(x) zxn_gfx_mode_fastcall(x)
+
+/*!
+This function plots a pixel on the ULA screen.
+@param x x-coordinate (0 - 255)
+@param y y-coordinate (0 - 191)
+*/
+void zxn_gfx_plot_callee(uint8_t x, uint8_t y) __z88dk_callee;
+#define zxn_gfx_plot(x, y) zxn_gfx_plot_callee(x, y)
+
+/*!
+This function draws a horizontal line on the ULA screen (clipped at the right
+border).
+@param x x-coordinate of the left end (0 - 255)
+@param y y-coordinate (0 - 191)
+@param uiLen Length in pixels (0 - 256)
+*/
+void zxn_gfx_hline_callee(uint8_t x, uint8_t y, uint16_t uiLen) __z88dk_callee;
+#define zxn_gfx_hline(x, y, l) zxn_gfx_hline_callee(x, y, l)
+
+/*!
+This function draws a vertical line on the ULA screen (clipped at the bottom
+border).
+@param x x-coordinate (0 - 255)
+@param y y-coordinate of the upper end (0 - 191)
+@param uiLen Length in pixels (0 - 192)
+*/
+void zxn_gfx_vline_callee(uint8_t x, uint8_t y, uint8_t uiLen) __z88dk_callee;
+#define zxn_gfx_vline(x, y, l) zxn_gfx_vline_callee(x, y, l)
+
+/*!
+This function draws a line between two points on the ULA screen (Bresenham).
+Both points must be on the screen.
+@param x0 x-coordinate of the first point (0 - 255)
+@param y0 y-coordinate of the first point (0 - 191)
+@param x1 x-coordinate of the second point (0 - 255)
+@param y1 y-coordinate of the second point (0 - 191)
+*/
+void zxn_gfx_line_callee(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1) __z88dk_callee;
+#define zxn_gfx_line(x0, y0, x1, y1) zxn_gfx_line_callee(x0, y0, x1, y1)
+
+/*!
+This function draws the outline of a rectangle on the ULA screen.
+@param x x-coordinate of the upper left corner (0 - 255)
+@param y y-coordinate of the upper left corner (0 - 191)
+@param uiWidth Width in pixels
+@param uiHeight Height in pixels
+*/
+void zxn_gfx_rect(uint8_t x, uint8_t y, uint16_t uiWidth, uint8_t uiHeight);
+
+/*!
+This function draws a filled rectangle on the ULA screen.
+@param x x-coordinate of the upper left corner (0 - 255)
+@param y y-coordinate of the upper left corner (0 - 191)
+@param uiWidth Width in pixels
+@param uiHeight Height in pixels
+*/
+void zxn_gfx_fill(uint8_t x, uint8_t y, uint16_t uiWidth, uint8_t uiHeight);
+
+/*!
+This function draws a 1-bit image on the ULA screen at any pixel position;
+only the set pixels of the image are drawn (clipped at the right and bottom
+border).
+@param x x-coordinate of the upper left corner (0 - 255)
+@param y y-coordinate of the upper left corner (0 - 191)
+@param pData Image data (row by row, "uiWidth" bytes per row, MSB = left)
+@param uiWidth Width of the image in bytes
+@param uiHeight Height of the image in rows
+*/
+void zxn_gfx_blit_callee(uint8_t x, uint8_t y, const uint8_t* pData, uint8_t uiWidth, uint8_t uiHeight) __z88dk_callee;
+#define zxn_gfx_blit(x, y, p, w, h) zxn_gfx_blit_callee(x, y, p, w, h)
+
+/*!
+This function sets up a double-buffered Layer 2 and makes it visible. The
+banks must be reserved by the application (i.e. through NextZXOS); if both
+buffers would overlap, the back buffer is placed behind the front buffer.
+@param pLayer Pointer to the state of the Layer 2
+@param uiMode Resolution ("ZXN_L2_256x192", ...)
+@param uiFront First 16K-bank of the displayed buffer (or "ZXN_L2_CURRENT")
+@param uiBack First 16K-bank of the back buffer (or "ZXN_L2_CURRENT")
+@return "EOK" = no error
+*/
+uint8_t zxn_l2_open(layer2_t* pLayer, uint8_t uiMode, uint8_t uiFront, uint8_t uiBack);
+
+/*!
+This function hides the Layer 2 and restores the mapping of the MMU slot
+"ZXN_PAGE_SLOT".
+@param pLayer Pointer to the state of the Layer 2
+*/
+void zxn_l2_close(layer2_t* pLayer) __z88dk_fastcall;
+
+/*!
+This function maps an 8K-segment of the back buffer into the MMU slot
+"ZXN_PAGE_SLOT".
+@param pLayer Pointer to the state of the Layer 2
+@param uiSegment Segment of the buffer (0 .. 2 * banks - 1)
+@return Pointer to the segment; "NULL" = invalid segment
+*/
+uint8_t* zxn_l2_page(layer2_t* pLayer, uint8_t uiSegment);
+
+/*!
+This function maps the segment of the back buffer, that contains the given
+pixel, and returns the address of its byte (256x192: row-major; 320x256 and
+640x256: column-major, two pixels per byte in 640x256).
+@param pLayer Pointer to the state of the Layer 2
+@param x x-coordinate
+@param y y-coordinate
+@return Pointer to the byte of the pixel; "NULL" = outside of the buffer
+*/
+uint8_t* zxn_l2_pixel(layer2_t* pLayer, uint16_t x, uint8_t y);
+
+/*!
+This function fills the back buffer with a colour by the zxnDMA.
+@param pLayer Pointer to the state of the Layer 2
+@param uiColour Colour (palette index; in 640x256 two pixels)
+*/
+void zxn_l2_clear(layer2_t* pLayer, uint8_t uiColour);
+
+/*!
+This function waits for the vertical blank and swaps front and back buffer by
+the registers "Layer 2 Active RAM Bank" (0x12) and "Layer 2 Shadow RAM Bank"
+(0x13).
+@param pLayer Pointer to the state of the Layer 2
+*/
+void zxn_flip(layer2_t* pLayer) __z88dk_fastcall;
+
+/*!
+This function opens a text console on Layer 2 (256x192): the Layer 2 is cleared
+with the paper colour and made visible. The console scrolls by the Y offset of
+Layer 2 - only the new line is cleared.
+@param pCon Pointer to the state of the console
+@param uiBank First 16K-bank of the Layer 2 (or "ZXN_L2_CURRENT")
+@param uiInk Colour of the characters (ULA colour: 0 .. 15)
+@param uiPaper Colour of the background (ULA colour: 0 .. 15)
+@return "EOK" = no error
+*/
+uint8_t zxn_con_open(console_t* pCon, uint8_t uiBank, uint8_t uiInk, uint8_t uiPaper);
+
+/*!
+This function hides the console.
+@param pCon Pointer to the state of the console
+*/
+void zxn_con_close(console_t* pCon) __z88dk_fastcall;
+
+/*!
+Set the cursor of the console (upper left corner = 0,0).
+@param pCon Pointer to the state of the console
+@param uiX Column (0 .. "ZXN_CON_COLS" - 1)
+@param uiY Row (0 .. "ZXN_CON_ROWS" - 1)
+*/
+void zxn_con_gotoxy(console_t* pCon, uint8_t uiX, uint8_t uiY);
+
+/*!
+Set the colour of the characters for the next outputs.
+@param pCon Pointer to the state of the console
+@param uiColor ULA colour ("0" = BLACK ... "7" = WHITE, + 8 = BRIGHT)
+*/
+void zxn_con_ink(console_t* pCon, uint8_t uiColor);
+
+/*!
+Set the colour of the background for the next outputs.
+@param pCon Pointer to the state of the console
+@param uiColor ULA colour ("0" = BLACK ... "7" = WHITE, + 8 = BRIGHT)
+*/
+void zxn_con_paper(console_t* pCon, uint8_t uiColor);
+
+/*!
+This function writes a string at the cursor. "\n" moves the cursor to the start
+of the next line; below the last line the console scrolls. The mapping of the
+MMU slot "ZXN_PAGE_SLOT" is restored before the function returns.
+@param pCon Pointer to the state of the console
+@param acText String to write
+*/
+void zxn_con_puts(console_t* pCon, const char_t* acText);
+
+/*!
+This function writes a single character at the cursor (see "zxn_con_puts").
+@param pCon Pointer to the state of the console
+@param cChar Character to write
+*/
+void zxn_con_putc(console_t* pCon, char_t cChar);
+
+/*!
+This function scrolls the console up by one line: the Y offset of Layer 2 is
+moved by 8 pixels and only the new bottom line is cleared.
+@param pCon Pointer to the state of the console
+*/
+void zxn_con_scroll(console_t* pCon) __z88dk_fastcall;
+
+/*!
+This function initialises a copper list.
+@param pCopper Pointer to the copper list
+@param pBuffer0 Buffer for "uiSize" instructions (2 bytes each)
+@param pBuffer1 Second buffer for double buffering (or "NULL")
+@param uiSize Capacity of a buffer in instructions (incl. the final "HALT")
+@return "EOK" = no error
+*/
+uint8_t zxn_copper_init(copper_t* pCopper, void* pBuffer0, void* pBuffer1, uint16_t uiSize);
+
+/*!
+This function appends the instruction "WAIT": the copper waits until the raster
+has reached the given position.
+@param pCopper Pointer to the copper list
+@param uiLine Raster line (0 .. 311)
+@param uiHPos Horizontal position in units of 8 pixels (0 .. 55)
+@return "EOK" = no error; "ERANGE" = list is full
+*/
+uint8_t zxn_copper_wait(copper_t* pCopper, uint16_t uiLine, uint8_t uiHPos);
+
+/*!
+This function appends the instruction "MOVE": the copper writes a value into a
+ZXN-register.
+@param pCopper Pointer to the copper list
+@param uiReg ZXN-register (0x00 .. 0x7F)
+@param uiValue Value to write
+@return "EOK" = no error; "ERANGE" = list is full
+*/
+uint8_t zxn_copper_move(copper_t* pCopper, uint8_t uiReg, uint8_t uiValue);
+
+/*!
+This function terminates the list with "HALT" and uploads it into the copper
+memory by a single zxnDMA transfer to the ZXN-register 0x60. The copper is
+stopped during the upload and started in the selected mode afterwards.
+@param pCopper Pointer to the copper list
+*/
+void zxn_copper_upload(copper_t* pCopper) __z88dk_fastcall;
+
+/*!
+This function waits for the vertical blank, uploads the list and starts a new
+(empty) list in the other buffer.
+@param pCopper Pointer to the copper list
+@remark The instructions "WAIT" of the lists must not wait for lines behind
+        the display area (192 ..).
+*/
+void zxn_copper_swap(copper_t* pCopper) __z88dk_fastcall;
+
+/*!
+This function stops the copper.
+*/
+void zxn_copper_stop(void);
+
+/*!
+This function uploads colours into a palette with a single zxnDMA transfer to
+the auto-incrementing ZXN-register 0x41 (8 bit) or 0x44 (9 bit).
+@param uiPalette Palette ("ZXN_PAL_ULA" .. "ZXN_PAL_TILEMAP" [| "ZXN_PAL_SECOND"])
+@param uiFirst Index of the first colour in the palette
+@param uiCount Number of colours (1 .. 256)
+@param pColours Colours
+@param uiFormat Format of the colours ("ZXN_PAL_8BIT", "ZXN_PAL_9BIT")
+@return "EOK" = no error
+@remark The transfer of 256 colours takes ~1000 (8 bit) or ~2000 (9 bit)
+        T-states, so it fits into the vertical blank.
+*/
+uint8_t zxn_palette_load(uint8_t uiPalette, uint8_t uiFirst, uint16_t uiCount, const void* pColours, uint8_t uiFormat);
+
+/*!
+This function calculates the colours of a fade step: every component of the
+source colours is scaled by "uiLevel / 8". The result is uploaded later (e.g.
+in the vertical blank) with "zxn_palette_load".
+@param pDest Faded colours
+@param pSrc Original colours
+@param uiCount Number of colours (1 .. 256)
+@param uiLevel Brightness ("ZXN_PAL_FADE_MIN" .. "ZXN_PAL_FADE_MAX")
+@param uiFormat Format of the colours ("ZXN_PAL_8BIT", "ZXN_PAL_9BIT")
+@return "EOK" = no error
+*/
+uint8_t zxn_palette_fade(void* pDest, const void* pSrc, uint16_t uiCount, uint8_t uiLevel, uint8_t uiFormat);
+
+/*!
+This function rotates colours in memory (colour cycling); a positive number of
+steps moves every colour to a higher index, the last ones wrap to the first.
+@param pColours Colours
+@param uiCount Number of colours (2 .. 256)
+@param iSteps Number of steps (negative = to lower indices)
+@param uiFormat Format of the colours ("ZXN_PAL_8BIT", "ZXN_PAL_9BIT")
+@return "EOK" = no error
+*/
+uint8_t zxn_palette_rotate(void* pColours, uint16_t uiCount, int8_t iSteps, uint8_t uiFormat);
+
+/*!
+This function selects the palette, that is displayed by a layer.
+@param uiPalette Palette ("ZXN_PAL_ULA" .. "ZXN_PAL_TILEMAP" [| "ZXN_PAL_SECOND"])
+*/
+void zxn_palette_show(uint8_t uiPalette) __z88dk_fastcall;
+
+/*!
+This function initialises the sprite table (all sprites invisible) and shows
+the sprite layer; the whole table is uploaded by the next "zxn_sprite_update".
+@param pTable Pointer to the sprite table
+*/
+void zxn_sprite_init(spritetable_t* pTable) __z88dk_fastcall;
+
+/*!
+This function sets all attributes of a sprite and makes it visible.
+@param pTable Pointer to the sprite table
+@param uiSprite Number of the sprite (0 .. 127)
+@param uiX Horizontal position (0 .. 511)
+@param uiY Vertical position (0 .. 511)
+@param uiPattern Number of the pattern (0 .. 63)
+@param uiFlags "ZXN_SPRITE_MIRROR_X", "ZXN_SPRITE_MIRROR_Y", "ZXN_SPRITE_ROTATE",
+               "ZXN_SPRITE_PALETTE(x)"
+@return "EOK" = no error
+*/
+uint8_t zxn_sprite_set(spritetable_t* pTable, uint8_t uiSprite, uint16_t uiX, uint16_t uiY, uint8_t uiPattern, uint8_t uiFlags);
+
+/*!
+This function moves a sprite.
+@param pTable Pointer to the sprite table
+@param uiSprite Number of the sprite (0 .. 127)
+@param uiX Horizontal position (0 .. 511)
+@param uiY Vertical position (0 .. 511)
+@return "EOK" = no error
+*/
+uint8_t zxn_sprite_move(spritetable_t* pTable, uint8_t uiSprite, uint16_t uiX, uint16_t uiY);
+
+/*!
+This function hides a sprite.
+@param pTable Pointer to the sprite table
+@param uiSprite Number of the sprite (0 .. 127)
+@return "EOK" = no error
+*/
+uint8_t zxn_sprite_hide(spritetable_t* pTable, uint8_t uiSprite);
+
+/*!
+This function uploads the attributes of all changed sprites with a single
+zxnDMA transfer to port 0x57 (the range from the first to the last changed
+sprite). It should be called once per frame.
+@param pTable Pointer to the sprite table
+*/
+void zxn_sprite_update(spritetable_t* pTable) __z88dk_fastcall;
+
+/*!
+This function uploads patterns (8 bit, 16x16 pixels) with a single zxnDMA
+transfer to port 0x5B.
+@param uiFirst Number of the first pattern (0 .. 63)
+@param uiCount Number of patterns
+@param pPatterns Patterns ("ZXN_SPRITE_PATTERN_SIZE" bytes each)
+@return "EOK" = no error
+*/
+uint8_t zxn_sprite_patterns(uint8_t uiFirst, uint8_t uiCount, const void* pPatterns);
+
+/*!
+This function configures and enables the tilemap.
+@param pTiles Pointer to the tilemap
+@param uiMode "ZXN_TILE_40x32" or "ZXN_TILE_80x32"
+@param uiFlags "ZXN_TILE_NOATTR", "ZXN_TILE_TEXT", "ZXN_TILE_512",
+               "ZXN_TILE_OVER_ULA"
+@param pMap Address of the map (bank 5: 0x4000 .. 0x7FFF, 256 bytes aligned)
+@param pDefs Address of the tile definitions (like "pMap")
+@return "EOK" = no error
+@remark
+The tilemap is written by the CPU: 0x4000 .. 0x5FFF must hold the lower half of
+bank 5 (default), the upper half is paged into "ZXN_PAGE_SLOT" by the library.
+*/
+uint8_t zxn_tile_open(tilemap_t* pTiles, uint8_t uiMode, uint8_t uiFlags, void* pMap, void* pDefs);
+
+/*!
+This function disables the tilemap.
+@param pTiles Pointer to the tilemap
+*/
+void zxn_tile_close(tilemap_t* pTiles) __z88dk_fastcall;
+
+/*!
+This function copies tile definitions (32 bytes per tile; 8 bytes in text
+mode) into the definitions of the tilemap. At most 256 tiles (512 with
+"ZXN_TILE_512") are available; all definitions must fit into bank 5.
+@param pTiles Pointer to the tilemap
+@param uiFirst Number of the first tile
+@param uiCount Number of tiles
+@param pDefs Tile definitions
+@return "EOK" = no error
+*/
+uint8_t zxn_tile_defs(tilemap_t* pTiles, uint16_t uiFirst, uint16_t uiCount, const void* pDefs);
+
+/*!
+This function puts a tile into the dirty list; a full list is written into the
+map at once.
+@param pTiles Pointer to the tilemap
+@param x Column
+@param y Row (0 .. 31)
+@param uiTile Number of the tile
+@param uiAttr Attribute (ignored with "ZXN_TILE_NOATTR")
+@return "EOK" = no error
+*/
+uint8_t zxn_tile_put(tilemap_t* pTiles, uint8_t x, uint8_t y, uint8_t uiTile, uint8_t uiAttr);
+
+/*!
+This function puts the characters of a string as tiles (attribute "uiAttr")
+into the dirty list; the string is clipped at the end of the row.
+@param pTiles Pointer to the tilemap
+@param x Column
+@param y Row (0 .. 31)
+@param acText String
+@return "EOK" = no error
+*/
+uint8_t zxn_tile_print(tilemap_t* pTiles, uint8_t x, uint8_t y, const char_t* acText);
+
+/*!
+This function sets the scroll offsets relative to the current ones (with
+wrap-around).
+@param pTiles Pointer to the tilemap
+@param iDX Horizontal distance in pixels
+@param iDY Vertical distance in pixels
+*/
+void zxn_tile_scroll(tilemap_t* pTiles, int16_t iDX, int16_t iDY);
+
+/*!
+This function writes the dirty list into the map and the changed scroll
+offsets into the hardware; it should be called once per frame.
+@param pTiles Pointer to the tilemap
+*/
+void zxn_tile_update(tilemap_t* pTiles) __z88dk_fastcall;
+
 /*============================================================================*/
 /*                               Implementierung                              */
 /*============================================================================*/
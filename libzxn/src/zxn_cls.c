@@ -41,10 +41,26 @@
 #include <arch/zxn.h>
 #include <arch/zxn/esxdos.h>
 #include "libzxn.h"
+#include "zxn_internal.h"
 
 /*============================================================================*/
 /*                               Defines                                      */
 /*============================================================================*/
+/*!
+Screen memory of the ULA (bank 5): bitmap, attributes and the second bitmap/
+attributes of the Timex modes
+*/
+#define ULA_BITMAP      ((void*) 0x4000)
+#define ULA_ATTR        ((void*) 0x5800)
+#define TIMEX_BITMAP    ((void*) 0x6000)
+#define ULA_BITMAP_SIZE (0x1800)
+#define ULA_ATTR_SIZE   (0x0300)
+
+/*!
+Number of 8K-pages of Layer 2: 256x192 (48K) and 320x256/640x256 (80K)
+*/
+#define L2_PAGES_256x192 (6)
+#define L2_PAGES_320x256 (10)
 
 /*============================================================================*/
 /*                               Namespaces                                   */
@@ -87,31 +103,67 @@ void zxn_cls_fastcall(uint8_t uiAttr) __z88dk_fastcall
 
   if (EOK == esx_ide_mode_get(&tMode))
   {
+    const uint8_t uiSpeed = zxn_getspeed();
+    const uint8_t uiPaper = (uiAttr >> 3) & 0x0F; /* paper incl. BRIGHT */
+    uint8_t uiBank;
+
+    zxn_setspeed(RTM_28MHZ);
+
     switch (tMode.mode8.layer)
     {
       case 0x00:
-        zx_cls(uiAttr);
+        zxn_dma_fill(ULA_BITMAP, ULA_BITMAP_SIZE, 0x00);
+        zxn_dma_fill(ULA_ATTR, ULA_ATTR_SIZE, uiAttr);
         break;
 
       case 0x01:
         switch (tMode.mode8.submode)
         {
           case 0:
-            /* TODO */
+            if (zxn_radastan_mode())
+            {
+              /* 128x96, 4 bit: two pixels per byte */
+              zxn_dma_fill(ULA_BITMAP, ULA_BITMAP_SIZE, uiPaper * 0x11);
+            }
+            else
+            {
+              /* 128x96, 8 bit: paper colours of the ULA palette (16 .. 31) */
+              zxn_dma_fill(ULA_BITMAP, ULA_BITMAP_SIZE, 0x10 | uiPaper);
+              zxn_dma_fill(TIMEX_BITMAP, ULA_BITMAP_SIZE, 0x10 | uiPaper);
+            }
             break;
           case 1:
-            tshc_cls(uiAttr);
+            zxn_dma_fill(ULA_BITMAP, ULA_BITMAP_SIZE, 0x00);
+            zxn_dma_fill(TIMEX_BITMAP, ULA_BITMAP_SIZE, uiAttr);
             break;
           case 2:
-            tshr_cls(uiAttr);
+            /* Colours are selected by port 0xFF */
+            zxn_dma_fill(ULA_BITMAP, ULA_BITMAP_SIZE, 0x00);
+            zxn_dma_fill(TIMEX_BITMAP, ULA_BITMAP_SIZE, 0x00);
             break;
         }
         break;
 
       case 0x02:
-        /* TODO */
+        uiBank = ZXN_READ_REG(REG_L2_ACTIVE_BANK) << 1; /* 16K-bank -> 8K-page */
+
+        switch (tMode.mode8.submode)
+        {
+          case 0:
+            zxn_dma_fill_pages(uiBank, L2_PAGES_256x192, g_acZxnL2Colour[uiPaper]);
+            break;
+          case 1:
+            zxn_dma_fill_pages(uiBank, L2_PAGES_320x256, g_acZxnL2Colour[uiPaper]);
+            break;
+          case 2:
+            /* 4 bit: two pixels per byte; palette index = paper (0 .. 15) */
+            zxn_dma_fill_pages(uiBank, L2_PAGES_320x256, uiPaper * 0x11);
+            break;
+        }
         break;
     }
+
+    zxn_setspeed(uiSpeed);
   }
 }
 
@@ -0,0 +1,96 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: zxn_con_gotoxy.c                                                   |
+| project:  ZX Spectrum Next - libzxn                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Text console on Layer 2 with hardware scrolling                              |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include "libzxn.h"
+#include "zxn_internal.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* zxn_con_gotoxy()                                                           */
+/*----------------------------------------------------------------------------*/
+void zxn_con_gotoxy(console_t* pCon, uint8_t uiX, uint8_t uiY)
+{
+  if (pCon)
+  {
+    pCon->uiX = (uiX < ZXN_CON_COLS) ? uiX : ZXN_CON_COLS - 1;
+    pCon->uiY = (uiY < ZXN_CON_ROWS) ? uiY : ZXN_CON_ROWS - 1;
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,118 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: zxn_con_open.c                                                     |
+| project:  ZX Spectrum Next - libzxn                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Text console on Layer 2 with hardware scrolling                              |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include "libzxn.h"
+#include "zxn_internal.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Address of the system variable "CHARS" (character set - 256)
+*/
+#define CON_SYSVAR_CHARS ((const uint8_t**) 0x5C36)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* zxn_con_open()                                                             */
+/*----------------------------------------------------------------------------*/
+uint8_t zxn_con_open(console_t* pCon, uint8_t uiBank, uint8_t uiInk, uint8_t uiPaper)
+{
+  if (pCon)
+  {
+    pCon->uiBank  = (ZXN_L2_CURRENT == uiBank) ? ZXN_READ_REG(REG_L2_ACTIVE_BANK) : uiBank;
+    pCon->uiX     = 0;
+    pCon->uiY     = 0;
+    pCon->uiInk   = g_acZxnL2Colour[uiInk & 0x0F];
+    pCon->uiPaper = g_acZxnL2Colour[uiPaper & 0x0F];
+    pCon->pFont   = *CON_SYSVAR_CHARS + 256;
+
+    pCon->tPriv.uiTop = 0;
+
+    zxn_dma_fill_pages(pCon->uiBank << 1, 6, pCon->uiPaper);
+
+    ZXN_WRITE_REG(REG_L2_CONTROL, ZXN_READ_REG(REG_L2_CONTROL) & 0xCF); /* 256x192 */
+    ZXN_WRITE_REG(REG_L2_ACTIVE_BANK, pCon->uiBank);
+    ZXN_WRITE_REG(REG_L2_OFFSET_X, 0);
+    ZXN_WRITE_REG(REG_L2_OFFSET_Y, 0);
+    IO_ZXN_L2_ACCESS = L2_ACCESS_VISIBLE;
+
+    return EOK;
+  }
+
+  return EINVAL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
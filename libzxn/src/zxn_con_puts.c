@@ -0,0 +1,163 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: zxn_con_puts.c                                                     |
+| project:  ZX Spectrum Next - libzxn                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Text console on Layer 2 with hardware scrolling                              |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include "libzxn.h"
+#include "zxn_internal.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* zxn_con_puts()                                                             */
+/*----------------------------------------------------------------------------*/
+void zxn_con_puts(console_t* pCon, const char_t* acText)
+{
+  const uint8_t* pGlyph;
+  uint8_t* pLine;
+  uint8_t* pPixel;
+  uint8_t uiRow;
+  uint8_t uiBits;
+  uint8_t uiLine;
+  char_t cChar;
+
+  if (pCon && acText)
+  {
+    const uint8_t uiMmu = ZXN_READ_REG(REG_MMU0 + ZXN_PAGE_SLOT);
+
+    while ('\0' != *acText)
+    {
+      /* Row of the buffer: the page is mapped once per line */
+      uiLine = pCon->tPriv.uiTop + pCon->uiY;
+      if (ZXN_CON_ROWS <= uiLine)
+      {
+        uiLine -= ZXN_CON_ROWS;
+      }
+
+      ZXN_WRITE_REG(REG_MMU0 + ZXN_PAGE_SLOT, (pCon->uiBank << 1) + (uiLine >> 2));
+      pLine = ZXN_PAGE_ADDR + ((uint16_t) (uiLine & 0x03) << 11);
+
+      while (('\0' != *acText) && ('\n' != *acText) && (ZXN_CON_COLS > pCon->uiX))
+      {
+        cChar = *acText++;
+
+        if ((' ' > cChar) || (0x7F < cChar))
+        {
+          cChar = '?';
+        }
+
+        pGlyph = pCon->pFont + ((uint16_t) (cChar - ' ') << 3);
+        pPixel = pLine + (pCon->uiX << 3);
+
+        for (uiRow = 0; uiRow < 8; ++uiRow)
+        {
+          uiBits = *pGlyph++;
+
+          for (uint8_t i = 0; i < 8; ++i)
+          {
+            *pPixel++ = (uiBits & 0x80) ? pCon->uiInk : pCon->uiPaper;
+            uiBits <<= 1;
+          }
+
+          pPixel += 256 - 8;
+        }
+
+        ++pCon->uiX;
+      }
+
+      if ('\n' == *acText)
+      {
+        ++acText;
+      }
+      else if (ZXN_CON_COLS > pCon->uiX)
+      {
+        break;
+      }
+
+      pCon->uiX = 0;
+
+      if (ZXN_CON_ROWS <= ++pCon->uiY)
+      {
+        pCon->uiY = ZXN_CON_ROWS - 1;
+        zxn_con_scroll(pCon);
+      }
+    }
+
+    ZXN_WRITE_REG(REG_MMU0 + ZXN_PAGE_SLOT, uiMmu);
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
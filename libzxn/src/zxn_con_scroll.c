@@ -0,0 +1,107 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: zxn_con_scroll.c                                                   |
+| project:  ZX Spectrum Next - libzxn                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Text console on Layer 2 with hardware scrolling                              |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include "libzxn.h"
+#include "zxn_internal.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* zxn_con_scroll()                                                           */
+/*----------------------------------------------------------------------------*/
+void zxn_con_scroll(console_t* pCon) __z88dk_fastcall
+{
+  if (pCon)
+  {
+    const uint8_t uiMmu = ZXN_READ_REG(REG_MMU0 + ZXN_PAGE_SLOT);
+
+    /* The old top row becomes the new bottom row: 2K within one 8K-page */
+    ZXN_WRITE_REG(REG_MMU0 + ZXN_PAGE_SLOT, (pCon->uiBank << 1) + (pCon->tPriv.uiTop >> 2));
+    zxn_dma_fill(ZXN_PAGE_ADDR + ((uint16_t) (pCon->tPriv.uiTop & 0x03) << 11), 0x0800, pCon->uiPaper);
+    ZXN_WRITE_REG(REG_MMU0 + ZXN_PAGE_SLOT, uiMmu);
+
+    if (ZXN_CON_ROWS <= ++pCon->tPriv.uiTop)
+    {
+      pCon->tPriv.uiTop = 0;
+    }
+
+    ZXN_WRITE_REG(REG_L2_OFFSET_Y, pCon->tPriv.uiTop << 3);
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
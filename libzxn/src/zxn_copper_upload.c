@@ -0,0 +1,117 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: zxn_copper_upload.c                                                |
+| project:  ZX Spectrum Next - libzxn                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Copper lists for raster-timed effects                                        |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stddef.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include "libzxn.h"
+#include "zxn_internal.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* zxn_copper_upload()                                                        */
+/*----------------------------------------------------------------------------*/
+void zxn_copper_upload(copper_t* pCopper) __z88dk_fastcall
+{
+  uint8_t* pInstr;
+
+  if (pCopper)
+  {
+    pInstr = pCopper->pList + (pCopper->uiCount << 1);
+
+    if ((0 == pCopper->uiCount) || (ZXN_COPPER_HALT != *((uint16_t*) (pInstr - 2))))
+    {
+      pInstr[0] = 0xFF;
+      pInstr[1] = 0xFF;
+      ++pCopper->uiCount;
+    }
+
+    /*
+    Stop the copper and write address 0: a running copper would continue
+    with the new instructions behind its position in the old list. The whole
+    list is written to NREG 0x60 by a single transfer.
+    */
+    ZXN_WRITE_REG(REG_COPPER_CTRL_HI, 0x00);
+    ZXN_WRITE_REG(REG_COPPER_CTRL_LO, 0x00);
+
+    zxn_dma_out_nreg(REG_COPPER_DATA, pCopper->pList, pCopper->uiCount << 1);
+
+    ZXN_WRITE_REG(REG_COPPER_CTRL_HI, pCopper->uiMode);
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
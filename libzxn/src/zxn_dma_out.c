@@ -0,0 +1,115 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: zxn_dma_out.c                                                      |
+| project:  ZX Spectrum Next - libzxn                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Function to transfer memory to an IO-port by the zxnDMA                      |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <arch/zxn.h>
+#include "libzxn.h"
+#include "zxn_internal.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* zxn_dma_out()                                                              */
+/*----------------------------------------------------------------------------*/
+void zxn_dma_out(const void* pSrc, uint16_t uiLength, uint16_t uiPort)
+{
+  if (0 < uiLength)
+  {
+    IO_ZXN_DMA = DMA_CMD_DISABLE;
+
+    IO_ZXN_DMA = DMA_WR0_A_TO_B;
+    IO_ZXN_DMA = (uint8_t) (((uint16_t) pSrc) & 0xFF);
+    IO_ZXN_DMA = (uint8_t) (((uint16_t) pSrc) >> 8);
+    IO_ZXN_DMA = (uint8_t) (uiLength & 0xFF);
+    IO_ZXN_DMA = (uint8_t) (uiLength >> 8);
+
+    IO_ZXN_DMA = DMA_WR1_MEM_INC;
+    IO_ZXN_DMA = DMA_TIMING_2;
+
+    IO_ZXN_DMA = DMA_WR2_IO_FIXED;
+    IO_ZXN_DMA = DMA_TIMING_2;
+
+    IO_ZXN_DMA = DMA_WR4_CONTINUOUS;
+    IO_ZXN_DMA = (uint8_t) (uiPort & 0xFF);
+    IO_ZXN_DMA = (uint8_t) (uiPort >> 8);
+
+    IO_ZXN_DMA = DMA_WR5_STOP;
+
+    IO_ZXN_DMA = DMA_CMD_LOAD;
+    IO_ZXN_DMA = DMA_CMD_ENABLE;
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
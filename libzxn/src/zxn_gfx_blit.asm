@@ -0,0 +1,133 @@
+SECTION code_user
+PUBLIC _zxn_gfx_blit_callee
+EXTERN asm_zxn_gfx_plot
+
+; ==============================================================================
+; void zxn_gfx_blit_callee(uint8_t x, uint8_t y, const uint8_t* pData,
+;                          uint8_t uiWidth, uint8_t uiHeight) __z88dk_callee
+; ------------------------------------------------------------------------------
+; draws a 1-bit image (uiWidth bytes x uiHeight rows) on the ULA screen
+; ------------------------------------------------------------------------------
+; Only the set pixels of the image are drawn in the current mode (transparent
+; background). Each source byte is split by "BSRL DE,B" into the parts of the
+; two screen bytes it covers; PIXELDN steps to the next row. The image is
+; clipped at the right and bottom border.
+;
+;   HL = address   B = shift (x & 7)   C = bytes left in the row   IX = pData
+;   B' = rows      C' = visible bytes  D' = clipped bytes          E' = spill
+; ==============================================================================
+_zxn_gfx_blit_callee:
+  pop hl          ; return address
+  pop de          ; E = x, D = y
+  pop bc          ; BC = pData
+  ex (sp), hl     ; L = uiWidth, H = uiHeight
+  push ix
+  ld ixl, c
+  ld ixh, b
+
+  ld a, d
+  cp 192
+  jr nc, bl_end
+
+  ; uiHeight = min(uiHeight, 192 - y)
+  ld a, 192
+  sub d
+  cp h
+  jr nc, bl_rows
+  ld h, a
+bl_rows:
+  ld a, h
+  or a
+  jr z, bl_end
+  ld a, l
+  or a
+  jr z, bl_end
+
+  ld b, h         ; B = rows
+  ld c, l         ; C = uiWidth
+  pixelad
+  push hl         ; [address]
+
+  ld a, e
+  and 7
+  ld l, a         ; L = shift
+  ld a, e
+  rrca
+  rrca
+  rrca
+  and $1F
+  neg
+  add a, 32
+  ld h, a         ; H = bytes up to the right border
+
+  ld a, c
+  cp h
+  ld e, 1         ; the last byte spills into the next one
+  jr c, bl_width
+  ld a, h
+  ld e, 0
+bl_width:
+  ld d, a         ; D = visible bytes
+  ld a, c
+  sub d
+  ld c, d         ; C = visible bytes
+  ld d, a         ; D = clipped bytes
+
+  ld a, l
+  push bc
+  push de
+  exx
+  pop de
+  pop bc
+  exx
+  ld b, a         ; B = shift
+  pop hl          ; HL = address
+
+bl_row:
+  push hl
+  exx
+  ld a, c
+  exx
+  ld c, a
+
+bl_byte:
+  ld d, (ix+0)
+  inc ix
+  ld e, 0
+  bsrl de, b      ; D = left part, E = right part
+  ld a, d
+  call asm_zxn_gfx_plot
+  inc l
+  dec c
+  jr z, bl_last
+  ld a, e
+  call asm_zxn_gfx_plot
+  jr bl_byte
+
+bl_last:
+  exx
+  ld a, e
+  exx
+  or a
+  jr z, bl_skip
+  ld a, e
+  call asm_zxn_gfx_plot
+
+bl_skip:
+  exx
+  ld a, d
+  exx
+  ld e, a
+  ld d, 0
+  add ix, de
+
+  pop hl
+  pixeldn
+  exx
+  dec b
+  exx
+  jr nz, bl_row
+
+bl_end:
+  pop ix
+  ret
@@ -0,0 +1,103 @@
+SECTION code_user
+PUBLIC _zxn_gfx_hline_callee
+EXTERN asm_zxn_gfx_plot
+
+; ==============================================================================
+; void zxn_gfx_hline_callee(uint8_t x, uint8_t y, uint16_t uiLen) __z88dk_callee
+; ------------------------------------------------------------------------------
+; draws a horizontal span of uiLen pixels on the ULA screen
+; ------------------------------------------------------------------------------
+; The span is clipped at the right border. PIXELAD/SETAE give the address and
+; the first pixel; the partial first and last bytes are masked, the bytes in
+; between are written as a whole.
+; ==============================================================================
+_zxn_gfx_hline_callee:
+  pop hl          ; return address
+  pop de          ; E = x, D = y
+  pop bc          ; BC = uiLen
+  push hl
+
+  ld a, d
+  cp 192
+  ret nc
+
+  ; uiLen = min(uiLen, 256 - x)
+  xor a
+  sub e
+  ld l, a
+  ld a, 1
+  sbc a, 0
+  ld h, a         ; HL = 256 - x
+  or a
+  sbc hl, bc
+  jr nc, hl_clipped
+  add hl, bc
+  ld b, h
+  ld c, l
+hl_clipped:
+  ld a, b
+  or c
+  ret z
+
+  pixelad         ; HL = address of the first byte
+  setae           ; A = mask of the first pixel
+  add a, a
+  dec a
+  ld d, a         ; D = mask of the first byte (pixel x .. end of byte)
+
+  ld a, e
+  and 7
+  add a, c
+  ld c, a
+  jr nc, hl_total
+  inc b           ; BC = (x & 7) + uiLen = pixels from the start of the byte
+hl_total:
+  ld a, b
+  or a
+  jr nz, hl_first
+  ld a, c
+  cp 9
+  jr nc, hl_first
+
+  call hl_endmask ; span within a single byte
+  and d
+  jp asm_zxn_gfx_plot
+
+hl_first:
+  ld a, d
+  call asm_zxn_gfx_plot
+  inc l
+
+hl_next:
+  ld a, c
+  sub 8
+  ld c, a
+  jr nc, hl_full
+  dec b
+hl_full:
+  ld a, b
+  or a
+  jr nz, hl_byte
+  ld a, c
+  cp 8
+  jr c, hl_last
+hl_byte:
+  ld a, $FF
+  call asm_zxn_gfx_plot
+  inc l
+  jr hl_next
+
+hl_last:
+  or a
+  ret z
+  call hl_endmask
+  jp asm_zxn_gfx_plot
+
+hl_endmask:       ; A = mask of the first C pixels of a byte (C = 1 .. 8)
+  ld b, c
+  xor a
+hl_bits:
+  scf
+  rra
+  djnz hl_bits
+  ret
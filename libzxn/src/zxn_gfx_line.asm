@@ -0,0 +1,191 @@
+SECTION code_user
+PUBLIC _zxn_gfx_line_callee
+EXTERN _g_uiZxnGfxMode
+
+; ==============================================================================
+; void zxn_gfx_line_callee(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
+; ------------------------------------------------------------------------------
+; draws a line on the ULA screen (Bresenham)
+; ------------------------------------------------------------------------------
+; The line is always drawn downwards (PIXELDN); the end points are swapped if
+; necessary. The start address and mask come from PIXELAD/SETAE, afterwards
+; the mask is rotated for a step in x and PIXELDN is used for a step in y:
+;
+;   HL  = address        C   = mask        B = number of pixels
+;   E   = dx             D   = dy          A' = error term
+;   IXH = pixels to set  IXL = pixels to toggle (drawing mode)
+;
+; Lines with an end point below the screen are ignored.
+; ==============================================================================
+_zxn_gfx_line_callee:
+  pop hl          ; return address
+  pop de          ; E = x0, D = y0
+  pop bc          ; C = x1, B = y1
+  push hl
+
+  ld a, d
+  cp 192
+  ret nc
+  ld a, b
+  cp 192
+  ret nc
+
+  cp d
+  jr nc, ln_down
+  ld a, e         ; y1 < y0: swap the end points
+  ld e, c
+  ld c, a
+  ld a, d
+  ld d, b
+  ld b, a
+ln_down:
+  push ix
+  ld a, (_g_uiZxnGfxMode)
+  ld ixh, a
+  ld a, (_g_uiZxnGfxMode + 1)
+  ld ixl, a
+
+  ld a, b
+  sub d
+  ld b, a         ; B = dy
+  pixelad         ; HL = address of (x0, y0)
+  ld a, c
+  sub e           ; A = x1 - x0; carry = to the left
+  push af
+  jr nc, ln_dx
+  neg
+ln_dx:
+  ld c, a         ; C = dx
+  setae           ; A = mask of x0
+  ld e, c         ; E = dx
+  ld d, b         ; D = dy
+  ld c, a         ; C = mask
+  pop af
+  jr c, ln_left
+
+  ld a, e
+  cp d
+  jr c, ln_ry
+
+ln_rx:          ; x is the major axis: B = dx + 1, A' = dx / 2
+  ld b, e
+  inc b
+  ld a, e
+  srl a
+  ex af, af'
+ln_rx_loop:
+  ld a, c         ; plot: (HL) = ((HL) | (C & set)) ^ (C & toggle)
+  and ixh
+  or (hl)
+  ld (hl), a
+  ld a, c
+  and ixl
+  xor (hl)
+  ld (hl), a
+  rrc c
+  jr nc, ln_rx_err
+  inc l
+ln_rx_err:
+  ex af, af'
+  sub d
+  jr nc, ln_rx_next
+  add a, e
+  pixeldn
+ln_rx_next:
+  ex af, af'
+  djnz ln_rx_loop
+  pop ix
+  ret
+
+ln_ry:          ; y is the major axis: B = dy + 1, A' = dy / 2
+  ld b, d
+  inc b
+  ld a, d
+  srl a
+  ex af, af'
+ln_ry_loop:
+  ld a, c         ; plot: (HL) = ((HL) | (C & set)) ^ (C & toggle)
+  and ixh
+  or (hl)
+  ld (hl), a
+  ld a, c
+  and ixl
+  xor (hl)
+  ld (hl), a
+  pixeldn
+  ex af, af'
+  sub e
+  jr nc, ln_ry_next
+  add a, d
+  rrc c
+  jr nc, ln_ry_next
+  inc l
+ln_ry_next:
+  ex af, af'
+  djnz ln_ry_loop
+  pop ix
+  ret
+
+ln_left:
+  ld a, e
+  cp d
+  jr c, ln_ly
+
+ln_lx:          ; x is the major axis: B = dx + 1, A' = dx / 2
+  ld b, e
+  inc b
+  ld a, e
+  srl a
+  ex af, af'
+ln_lx_loop:
+  ld a, c         ; plot: (HL) = ((HL) | (C & set)) ^ (C & toggle)
+  and ixh
+  or (hl)
+  ld (hl), a
+  ld a, c
+  and ixl
+  xor (hl)
+  ld (hl), a
+  rlc c
+  jr nc, ln_lx_err
+  dec l
+ln_lx_err:
+  ex af, af'
+  sub d
+  jr nc, ln_lx_next
+  add a, e
+  pixeldn
+ln_lx_next:
+  ex af, af'
+  djnz ln_lx_loop
+  pop ix
+  ret
+
+ln_ly:          ; y is the major axis: B = dy + 1, A' = dy / 2
+  ld b, d
+  inc b
+  ld a, d
+  srl a
+  ex af, af'
+ln_ly_loop:
+  ld a, c         ; plot: (HL) = ((HL) | (C & set)) ^ (C & toggle)
+  and ixh
+  or (hl)
+  ld (hl), a
+  ld a, c
+  and ixl
+  xor (hl)
+  ld (hl), a
+  pixeldn
+  ex af, af'
+  sub e
+  jr nc, ln_ly_next
+  add a, d
+  rlc c
+  jr nc, ln_ly_next
+  dec l
+ln_ly_next:
+  ex af, af'
+  djnz ln_ly_loop
+  pop ix
+  ret
@@ -0,0 +1,40 @@
+SECTION code_user
+PUBLIC _zxn_gfx_plot_callee
+PUBLIC asm_zxn_gfx_plot
+EXTERN _g_uiZxnGfxMode
+
+; ==============================================================================
+; void zxn_gfx_plot_callee(uint8_t x, uint8_t y) __z88dk_callee
+; ------------------------------------------------------------------------------
+; plots a pixel on the ULA screen in the current drawing mode
+; ------------------------------------------------------------------------------
+; asm_zxn_gfx_plot: combines the pixels of the mask A with the byte (HL):
+;                   "(HL) = ((HL) | (A & set)) ^ (A & toggle)", where set/toggle
+;                   are the low/high byte of "g_uiZxnGfxMode".
+;                   Changes A and the flags only.
+; ==============================================================================
+_zxn_gfx_plot_callee:
+  pop hl
+  ex (sp), hl     ; L = x, H = y
+  ex de, hl       ; E = x, D = y
+
+  ld a, d
+  cp 192
+  ret nc
+
+  pixelad         ; HL = address of the pixel byte
+  setae           ; A = mask of the pixel
+
+asm_zxn_gfx_plot:
+  push bc
+  ld c, a
+  ld a, (_g_uiZxnGfxMode)
+  and c
+  or (hl)
+  ld b, a
+  ld a, (_g_uiZxnGfxMode + 1)
+  and c
+  xor b
+  ld (hl), a
+  pop bc
+  ret
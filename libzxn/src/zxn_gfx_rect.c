@@ -0,0 +1,111 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: zxn_gfx_rect.c                                                     |
+| project:  ZX Spectrum Next - libzxn                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Graphics primitives for the ULA screen                                       |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include "libzxn.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* zxn_gfx_rect()                                                             */
+/*----------------------------------------------------------------------------*/
+void zxn_gfx_rect(uint8_t x, uint8_t y, uint16_t uiWidth, uint8_t uiHeight)
+{
+  if ((192 > y) && (0 < uiWidth) && (0 < uiHeight))
+  {
+    zxn_gfx_hline(x, y, uiWidth);
+
+    if (1 < uiHeight)
+    {
+      if ((uint16_t) (192 - y) >= uiHeight)
+      {
+        zxn_gfx_hline(x, y + uiHeight - 1, uiWidth);
+      }
+
+      if (2 < uiHeight)
+      {
+        /* The corners belong to the horizontal lines (mode "XOR") */
+        zxn_gfx_vline(x, y + 1, uiHeight - 2);
+
+        if ((1 < uiWidth) && ((uint16_t) (256 - x) >= uiWidth))
+        {
+          zxn_gfx_vline(x + uiWidth - 1, y + 1, uiHeight - 2);
+        }
+      }
+    }
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
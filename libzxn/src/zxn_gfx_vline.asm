@@ -0,0 +1,54 @@
+SECTION code_user
+PUBLIC _zxn_gfx_vline_callee
+EXTERN _g_uiZxnGfxMode
+
+; ==============================================================================
+; void zxn_gfx_vline_callee(uint8_t x, uint8_t y, uint8_t uiLen) __z88dk_callee
+; ------------------------------------------------------------------------------
+; draws a vertical span of uiLen pixels on the ULA screen
+; ------------------------------------------------------------------------------
+; The span is clipped at the bottom border. The mask of the column is the same
+; for all pixels, so the drawing mode is applied once and the loop only steps
+; down with PIXELDN (43 T-states per pixel).
+; ==============================================================================
+_zxn_gfx_vline_callee:
+  pop hl          ; return address
+  pop de          ; E = x, D = y
+  dec sp
+  pop af          ; A = uiLen
+  push hl
+
+  ld b, a
+  ld a, d
+  cp 192
+  ret nc
+
+  ; uiLen = min(uiLen, 192 - y)
+  ld a, 192
+  sub d
+  cp b
+  jr nc, vl_clipped
+  ld b, a
+vl_clipped:
+  inc b
+  dec b
+  ret z
+
+  pixelad         ; HL = address of the first pixel
+  setae
+  ld c, a         ; C = mask of the column
+  ld a, (_g_uiZxnGfxMode)
+  and c
+  ld d, a         ; D = pixels to set
+  ld a, (_g_uiZxnGfxMode + 1)
+  and c
+  ld e, a         ; E = pixels to toggle
+
+vl_loop:
+  ld a, (hl)
+  or d
+  xor e
+  ld (hl), a
+  pixeldn
+  djnz vl_loop
+  ret
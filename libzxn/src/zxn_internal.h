@@ -0,0 +1,266 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: zxn_internal.h                                                     |
+| project:  ZX Spectrum Next - libzxn                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Internal definitions of libzxn (zxnDMA, MMU, Layer 2)                        |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+#if !defined(__ZXN_INTERNAL_H__)
+  #define __ZXN_INTERNAL_H__
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include "libzxn.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*--- Commands and register values of the zxnDMA ----------------------------*/
+#define DMA_CMD_DISABLE     (0x83)  /* WR6: disable DMA */
+#define DMA_CMD_ENABLE      (0x87)  /* WR6: enable DMA */
+#define DMA_CMD_LOAD        (0xCF)  /* WR6: load start addresses */
+#define DMA_WR0_A_TO_B      (0x7D)  /* A -> B; port A address, length follow */
+#define DMA_WR1_MEM_FIXED   (0x64)  /* port A: memory, fixed; timing follows */
+#define DMA_WR1_MEM_INC     (0x54)  /* port A: memory, incremented; timing follows */
+#define DMA_WR2_MEM_INC     (0x50)  /* port B: memory, incremented; timing follows */
+#define DMA_WR2_IO_FIXED    (0x68)  /* port B: IO, fixed; timing follows */
+#define DMA_TIMING_2        (0x02)  /* cycle length 2 */
+#define DMA_WR4_CONTINUOUS  (0xAD)  /* continuous mode; port B address follows */
+#define DMA_WR5_STOP        (0x82)  /* stop at end of block */
+
+/*!
+Number of the first MMU next-reg (slot 0, 0x0000 .. 0x1FFF)
+*/
+#if !defined(REG_MMU0)
+  #define REG_MMU0 (0x50)
+#endif
+
+/*!
+Number of the ZXN-registers "Layer 2 Active RAM Bank" and "Layer 2 Shadow RAM
+Bank" (16K-banks)
+*/
+#define REG_L2_ACTIVE_BANK (0x12)
+#define REG_L2_SHADOW_BANK (0x13)
+
+/*!
+Number of the ZXN-register "Layer 2 Control" (resolution: BIT5:4)
+*/
+#define REG_L2_CONTROL (0x70)
+
+/*!
+Number of the ZXN-registers "Layer 2 X Offset" and "Layer 2 Y Offset"
+*/
+#define REG_L2_OFFSET_X (0x16)
+#define REG_L2_OFFSET_Y (0x17)
+
+/*!
+Number of the ZXN-registers "Active Video Line" (MSB: BIT0, LSB)
+*/
+#define REG_VIDEO_LINE_H (0x1E)
+#define REG_VIDEO_LINE_L (0x1F)
+
+/*!
+Layer 2 access port (0x123B): BIT1 = Layer 2 visible
+*/
+#define L2_ACCESS_VISIBLE (0x02)
+
+/*!
+Number of the ZXN-registers of the copper: data (8 bit), control LSB (address
+BIT7:0), control MSB (mode BIT7:6, address BIT2:0)
+*/
+#define REG_COPPER_DATA    (0x60)
+#define REG_COPPER_CTRL_LO (0x61)
+#define REG_COPPER_CTRL_HI (0x62)
+
+/*!
+Number of the ZXN-registers of the palettes: index, colour (8 bit), control
+(BIT6:4 palette to write, BIT3:1 active second palettes) and colour (9 bit, 2
+writes); number of the ZXN-register "tilemap control" (BIT4: second palette)
+*/
+#define REG_PAL_INDEX    (0x40)
+#define REG_PAL_VALUE8   (0x41)
+#define REG_PAL_CONTROL  (0x43)
+#define REG_PAL_VALUE9   (0x44)
+#define REG_TILE_CONTROL (0x6B)
+
+/*!
+Number of the ZXN-registers of the tilemap: default attribute, base addresses
+of map and definitions (MSB of the offset in bank 5), offsets (scroll) X
+(BIT9:8, BIT7:0) and Y; bit "enable" of the control register
+*/
+#define REG_TILE_ATTR      (0x6C)
+#define REG_TILE_MAP_BASE  (0x6E)
+#define REG_TILE_DEF_BASE  (0x6F)
+#define REG_TILE_OFFSET_XH (0x2F)
+#define REG_TILE_OFFSET_XL (0x30)
+#define REG_TILE_OFFSET_Y  (0x31)
+#define TILE_ENABLE        (0x80)
+
+/*!
+Tilemap and definitions are located in bank 5 (0x4000 .. 0x7FFF), aligned to
+256 bytes
+*/
+#define TILE_BANK5      (0x4000)
+#define TILE_BANK5_SIZE (0x4000)
+#define TILE_BASE_MASK  (0xC0FF)
+
+/*!
+8K-page of the upper half of bank 5 (0x6000 .. 0x7FFF), that is paged into the
+slot "ZXN_PAGE_SLOT" while the tilemap is written
+*/
+#define TILE_BANK5_PAGE (11)
+
+/*!
+Number of the ZXN-register "sprite and layers system" (BIT0: sprites visible)
+*/
+#define REG_SPRITE_SYSTEM (0x15)
+
+/*!
+Bits of the sprite attribute 3 (all sprites of the table use 5 attributes)
+*/
+#define SPRITE_ATTR3_VISIBLE (0x80)
+#define SPRITE_ATTR3_ATTR4   (0x40)
+
+/*!
+IO-ports to upload sprite attributes and patterns (auto-increment)
+*/
+#define ZXN_PORT_SPRITE_ATTR    (0x0057)
+#define ZXN_PORT_SPRITE_PATTERN (0x005B)
+
+/*!
+IO-port to select a ZXN-register and IO-port to write/read the selected one
+*/
+#define ZXN_PORT_NREG_SELECT (0x243B)
+#define ZXN_PORT_NREG_DATA   (0x253B)
+
+/*!
+Size of a 8K-page
+*/
+#define ZXN_PAGE_SIZE (0x2000)
+
+/*!
+Address of the MMU slot "ZXN_PAGE_SLOT"
+*/
+#define ZXN_PAGE_ADDR ((uint8_t*) (ZXN_PAGE_SLOT * ZXN_PAGE_SIZE))
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+/*!
+IO-port of the zxnDMA (zxnDMA mode)
+*/
+__sfr __at 0x6B IO_ZXN_DMA;
+
+/*!
+IO-port "Layer 2 Access"
+*/
+__sfr __banked __at 0x123B IO_ZXN_L2_ACCESS;
+
+/*!
+IO-port to select a ZXN-register
+*/
+__sfr __banked __at 0x243B IO_ZXN_NREG_SELECT;
+
+/*!
+IO-port to select the sprite and pattern slot of the uploads
+*/
+__sfr __banked __at 0x303B IO_ZXN_SPRITE_SLOT;
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+/*!
+This function fills consecutive 8K-pages with a byte by the zxnDMA. The pages
+are mapped one after another into MMU slot "ZXN_PAGE_SLOT"; the previous mapping
+of the slot is restored afterwards.
+@param uiPage First 8K-page to fill
+@param uiCount Number of pages to fill
+@param uiValue Value to write
+*/
+void zxn_dma_fill_pages(uint8_t uiPage, uint8_t uiCount, uint8_t uiValue);
+
+/*!
+This function transfers a block of memory to an IO-port by the zxnDMA
+(continuous mode); the CPU is halted until the block has been transferred.
+@param pSrc First byte to transfer
+@param uiLength Number of bytes to transfer
+@param uiPort IO-port (16 bit)
+*/
+void zxn_dma_out(const void* pSrc, uint16_t uiLength, uint16_t uiPort);
+
+/*!
+This function transfers a block of memory to a ZXN-register by the zxnDMA
+(port 0x253B). Selection and transfer run with disabled interrupts, so an ISR
+can't select another register in between; the interrupt state is restored.
+@param uiReg ZXN-register
+@param pSrc First byte to transfer
+@param uiLength Number of bytes to transfer
+*/
+void zxn_dma_out_nreg(uint8_t uiReg, const void* pSrc, uint16_t uiLength);
+
+/*!
+This function waits until the raster is within the 8 lines starting at the
+given line (i.e. the first lines of the vertical blank).
+@param uiLine First raster line
+*/
+void zxn_wait_line(uint16_t uiLine) __z88dk_fastcall;
+
+/*!
+This function adds a sprite to the range of sprites, that are uploaded by the
+next call of "zxn_sprite_update".
+@param pTable Pointer to the sprite table
+@param uiSprite Number of the sprite
+*/
+void zxn_sprite_dirty(spritetable_t* pTable, uint8_t uiSprite);
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
+
+#endif /* __ZXN_INTERNAL_H__ */
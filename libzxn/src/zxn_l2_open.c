@@ -0,0 +1,128 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: zxn_l2_open.c                                                      |
+| project:  ZX Spectrum Next - libzxn                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Double-buffered Layer 2 with page flipping                                   |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stddef.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include "libzxn.h"
+#include "zxn_internal.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+/*!
+Number of 16K-banks of the Next (2 MB)
+*/
+#define L2_MAX_BANKS (112)
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* zxn_l2_open()                                                              */
+/*----------------------------------------------------------------------------*/
+uint8_t zxn_l2_open(layer2_t* pLayer, uint8_t uiMode, uint8_t uiFront, uint8_t uiBack)
+{
+  if (pLayer && (ZXN_L2_640x256 >= uiMode))
+  {
+    pLayer->uiMode  = uiMode;
+    pLayer->uiBanks = (ZXN_L2_256x192 == uiMode) ? 3 : 5;
+    pLayer->uiFront = (ZXN_L2_CURRENT == uiFront) ? ZXN_READ_REG(REG_L2_ACTIVE_BANK) : uiFront;
+    pLayer->uiBack  = (ZXN_L2_CURRENT == uiBack) ? ZXN_READ_REG(REG_L2_SHADOW_BANK) : uiBack;
+
+    if (((pLayer->uiBack + pLayer->uiBanks) > pLayer->uiFront) &&
+        ((pLayer->uiFront + pLayer->uiBanks) > pLayer->uiBack))
+    {
+      pLayer->uiBack = pLayer->uiFront + pLayer->uiBanks;
+    }
+
+    if (((pLayer->uiFront + pLayer->uiBanks) > L2_MAX_BANKS) ||
+        ((pLayer->uiBack + pLayer->uiBanks) > L2_MAX_BANKS))
+    {
+      return ERANGE;
+    }
+
+    /* The display area of 320x256/640x256 ends 32 lines below the ULA screen */
+    pLayer->tPriv.uiVBlank = (ZXN_L2_256x192 == uiMode) ? 192 : 224;
+    pLayer->tPriv.uiMmu    = ZXN_READ_REG(REG_MMU0 + ZXN_PAGE_SLOT);
+
+    ZXN_WRITE_REG(REG_L2_CONTROL, (ZXN_READ_REG(REG_L2_CONTROL) & 0xCF) | (uiMode << 4));
+    ZXN_WRITE_REG(REG_L2_ACTIVE_BANK, pLayer->uiFront);
+    ZXN_WRITE_REG(REG_L2_SHADOW_BANK, pLayer->uiBack);
+    IO_ZXN_L2_ACCESS = L2_ACCESS_VISIBLE;
+
+    return EOK;
+  }
+
+  return EINVAL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,131 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: zxn_l2_pixel.c                                                     |
+| project:  ZX Spectrum Next - libzxn                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Double-buffered Layer 2 with page flipping                                   |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stddef.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include "libzxn.h"
+#include "zxn_internal.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* zxn_l2_pixel()                                                             */
+/*----------------------------------------------------------------------------*/
+uint8_t* zxn_l2_pixel(layer2_t* pLayer, uint16_t x, uint8_t y)
+{
+  uint8_t* pSegment;
+  uint16_t uiOffset;
+
+  if (pLayer)
+  {
+    switch (pLayer->uiMode)
+    {
+      case ZXN_L2_256x192: /* row-major: 32 rows per segment */
+        if ((256 <= x) || (192 <= y))
+        {
+          return NULL;
+        }
+        pSegment = zxn_l2_page(pLayer, y >> 5);
+        uiOffset = ((uint16_t) (y & 0x1F) << 8) | x;
+        break;
+
+      case ZXN_L2_320x256: /* column-major: 32 columns per segment */
+        if (320 <= x)
+        {
+          return NULL;
+        }
+        pSegment = zxn_l2_page(pLayer, x >> 5);
+        uiOffset = ((x & 0x1F) << 8) | y;
+        break;
+
+      default:             /* column-major, 4 bit: 64 columns per segment */
+        if (640 <= x)
+        {
+          return NULL;
+        }
+        pSegment = zxn_l2_page(pLayer, x >> 6);
+        uiOffset = (((x >> 1) & 0x1F) << 8) | y;
+        break;
+    }
+
+    return pSegment + uiOffset;
+  }
+
+  return NULL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,146 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: zxn_palette_fade.c                                                 |
+| project:  ZX Spectrum Next - libzxn                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Palettes of ULA, Layer 2, sprites and tilemap                                |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stddef.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include "libzxn.h"
+#include "zxn_internal.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+/*!
+Components (3 bit) scaled by 0/8 .. 8/8
+*/
+static const uint8_t g_acFade[ZXN_PAL_FADE_MAX + 1][8] =
+{
+  {0, 0, 0, 0, 0, 0, 0, 0},
+  {0, 0, 0, 0, 0, 1, 1, 1},
+  {0, 0, 0, 1, 1, 1, 2, 2},
+  {0, 0, 1, 1, 2, 2, 2, 3},
+  {0, 1, 1, 2, 2, 3, 3, 4},
+  {0, 1, 1, 2, 3, 3, 4, 4},
+  {0, 1, 2, 2, 3, 4, 5, 5},
+  {0, 1, 2, 3, 4, 4, 5, 6},
+  {0, 1, 2, 3, 4, 5, 6, 7}
+};
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* zxn_palette_fade()                                                         */
+/*----------------------------------------------------------------------------*/
+uint8_t zxn_palette_fade(void* pDest, const void* pSrc, uint16_t uiCount, uint8_t uiLevel, uint8_t uiFormat)
+{
+  const uint8_t* pScale;
+  const uint8_t* pIn  = (const uint8_t*) pSrc;
+  uint8_t*       pOut = (uint8_t*) pDest;
+  uint8_t uiColour;
+  uint8_t uiBlue;
+
+  if (pDest && pSrc && ZXN_BETWEEN(uiCount, 1, ZXN_PAL_ENTRIES) && (ZXN_PAL_FADE_MAX >= uiLevel))
+  {
+    pScale = g_acFade[uiLevel];
+
+    if (ZXN_PAL_8BIT == uiFormat)
+    {
+      while (uiCount--)
+      {
+        uiColour = *pIn++;
+        uiBlue   = (uiColour & 0x03) << 1;
+        uiBlue  |= (uiBlue ? 0x01 : 0x00);   /* 2 bit -> 3 bit like the hardware */
+
+        *pOut++ = (pScale[uiColour >> 5] << 5) | (pScale[(uiColour >> 2) & 0x07] << 2) | (pScale[uiBlue] >> 1);
+      }
+
+      return EOK;
+    }
+    else if (ZXN_PAL_9BIT == uiFormat)
+    {
+      while (uiCount--)
+      {
+        uiColour = *pIn++;
+        uiBlue   = pScale[((uiColour & 0x03) << 1) | (*pIn & 0x01)];
+
+        *pOut++ = (pScale[uiColour >> 5] << 5) | (pScale[(uiColour >> 2) & 0x07] << 2) | (uiBlue >> 1);
+        *pOut++ = (*pIn++ & 0x80) | (uiBlue & 0x01);
+      }
+
+      return EOK;
+    }
+  }
+
+  return EINVAL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,104 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: zxn_palette_load.c                                                 |
+| project:  ZX Spectrum Next - libzxn                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Palettes of ULA, Layer 2, sprites and tilemap                                |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stddef.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include "libzxn.h"
+#include "zxn_internal.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* zxn_palette_load()                                                         */
+/*----------------------------------------------------------------------------*/
+uint8_t zxn_palette_load(uint8_t uiPalette, uint8_t uiFirst, uint16_t uiCount, const void* pColours, uint8_t uiFormat)
+{
+  if (pColours && ZXN_BETWEEN(uiCount, 1, ZXN_PAL_ENTRIES) && ZXN_BETWEEN(uiFormat, ZXN_PAL_8BIT, ZXN_PAL_9BIT))
+  {
+    /* Auto-increment on (BIT7 = 0), select the palette to write */
+    ZXN_WRITE_REG(REG_PAL_CONTROL, (ZXN_READ_REG(REG_PAL_CONTROL) & 0x0F) | (uiPalette & 0x70));
+    ZXN_WRITE_REG(REG_PAL_INDEX, uiFirst);
+
+    zxn_dma_out_nreg(ZXN_PAL_8BIT == uiFormat ? REG_PAL_VALUE8 : REG_PAL_VALUE9, pColours, uiCount * uiFormat);
+
+    return EOK;
+  }
+
+  return EINVAL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,121 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: zxn_palette_rotate.c                                               |
+| project:  ZX Spectrum Next - libzxn                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Palettes of ULA, Layer 2, sprites and tilemap                                |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stddef.h>
+#include <errno.h>
+#include <string.h>
+#include <arch/zxn.h>
+#include "libzxn.h"
+#include "zxn_internal.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* zxn_palette_rotate()                                                       */
+/*----------------------------------------------------------------------------*/
+uint8_t zxn_palette_rotate(void* pColours, uint16_t uiCount, int8_t iSteps, uint8_t uiFormat)
+{
+  uint8_t* pFirst = (uint8_t*) pColours;
+  uint8_t* pLast;
+  uint16_t uiLength;
+  uint8_t  acSave[2];
+
+  if (pColours && ZXN_BETWEEN(uiCount, 2, ZXN_PAL_ENTRIES) && ZXN_BETWEEN(uiFormat, ZXN_PAL_8BIT, ZXN_PAL_9BIT))
+  {
+    uiLength = (uiCount - 1) * uiFormat;
+    pLast    = pFirst + uiLength;
+
+    for (; 0 < iSteps; --iSteps)
+    {
+      memcpy(acSave, pLast, uiFormat);
+      memmove(pFirst + uiFormat, pFirst, uiLength);
+      memcpy(pFirst, acSave, uiFormat);
+    }
+
+    for (; 0 > iSteps; ++iSteps)
+    {
+      memcpy(acSave, pFirst, uiFormat);
+      memmove(pFirst, pFirst + uiFormat, uiLength);
+      memcpy(pLast, acSave, uiFormat);
+    }
+
+    return EOK;
+  }
+
+  return EINVAL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
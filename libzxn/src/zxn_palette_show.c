@@ -0,0 +1,106 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: zxn_palette_show.c                                                 |
+| project:  ZX Spectrum Next - libzxn                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Palettes of ULA, Layer 2, sprites and tilemap                                |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stddef.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include "libzxn.h"
+#include "zxn_internal.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* zxn_palette_show()                                                         */
+/*----------------------------------------------------------------------------*/
+void zxn_palette_show(uint8_t uiPalette) __z88dk_fastcall
+{
+  const uint8_t bSecond = (0 != (uiPalette & ZXN_PAL_SECOND));
+  uint8_t uiMask;
+
+  if (ZXN_PAL_TILEMAP == (uiPalette & 0x30))
+  {
+    uiMask = 0x10;
+    ZXN_WRITE_REG(REG_TILE_CONTROL, (ZXN_READ_REG(REG_TILE_CONTROL) & ~uiMask) | (bSecond ? uiMask : 0x00));
+  }
+  else
+  {
+    /* BIT1: ULA, BIT2: Layer 2, BIT3: sprites */
+    uiMask = 0x02 << ((uiPalette & 0x30) >> 4);
+    ZXN_WRITE_REG(REG_PAL_CONTROL, (ZXN_READ_REG(REG_PAL_CONTROL) & ~uiMask) | (bSecond ? uiMask : 0x00));
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,157 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: zxn_text_draw.c                                                    |
+| project:  ZX Spectrum Next - libzxn                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Direct output of text into the screen memory (ULA/Timex hi-res)              |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <errno.h>
+#include "libzxn.h"
+#include "zxn_text_internal.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* zxn_text_draw()                                                            */
+/*----------------------------------------------------------------------------*/
+void zxn_text_draw(const textstate_t* pState, uint8_t* pLine, char_t cChar)
+{
+  const uint8_t* pGlyph;
+  uint8_t* pCell;
+  uint8_t uiRow;
+
+  if ((' ' > cChar) || (0x7F < cChar))
+  {
+    cChar = '?';
+  }
+
+  pGlyph = pState->pFont + ((uint16_t) (cChar - ' ') << 3);
+
+  switch (pState->uiMode)
+  {
+    case ZXN_TEXT_32:
+      pCell = pLine + pState->uiX;
+
+      for (uiRow = 0; uiRow < 8; ++uiRow)
+      {
+        *pCell = *pGlyph++;
+        pCell += 256; /* next pixel row within the cell */
+      }
+
+      TEXT_ULA_ATTR[((uint16_t) pState->uiY << 5) + pState->uiX] = pState->uiAttr;
+      break;
+
+    case ZXN_TEXT_64:
+      /* even columns in the first bitmap, odd columns in the second one */
+      pCell = pLine + (pState->uiX >> 1) + ((pState->uiX & 0x01) ? TEXT_TIMEX_OFFSET : 0);
+
+      for (uiRow = 0; uiRow < 8; ++uiRow)
+      {
+        *pCell = *pGlyph++;
+        pCell += 256;
+      }
+      break;
+
+    case ZXN_TEXT_85:
+    {
+      /* 6 pixels at pixel column x * 6; the glyph may span two bytes */
+      const uint16_t uiPixel = (uint16_t) pState->uiX * 6;
+      const uint8_t uiByte  = (uint8_t) (uiPixel >> 3);
+      const uint8_t uiShift = (uint8_t) (uiPixel & 0x07);
+      const uint8_t uiMaskL = (uint8_t) (0xFC >> uiShift);
+      const uint8_t uiMaskR = (uint8_t) (0xFC << (8 - uiShift));
+      uint8_t* pRight;
+      uint8_t uiBits;
+
+      pCell  = pLine + (uiByte >> 1) + ((uiByte & 0x01) ? TEXT_TIMEX_OFFSET : 0);
+      pRight = pLine + ((uiByte + 1) >> 1) + ((uiByte & 0x01) ? 0 : TEXT_TIMEX_OFFSET);
+
+      for (uiRow = 0; uiRow < 8; ++uiRow)
+      {
+        uiBits = (*pGlyph++ << 1) & 0xFC;
+
+        *pCell = (*pCell & ~uiMaskL) | (uiBits >> uiShift);
+
+        if (uiMaskR)
+        {
+          *pRight = (*pRight & ~uiMaskR) | (uint8_t) (uiBits << (8 - uiShift));
+          pRight += 256;
+        }
+
+        pCell += 256;
+      }
+      break;
+    }
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,116 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: zxn_tile_defs.c                                                    |
+| project:  ZX Spectrum Next - libzxn                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Tilemap (Layer 3) with dirty-tile updates                                    |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stddef.h>
+#include <errno.h>
+#include <string.h>
+#include <arch/zxn.h>
+#include "libzxn.h"
+#include "zxn_internal.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* zxn_tile_defs()                                                            */
+/*----------------------------------------------------------------------------*/
+uint8_t zxn_tile_defs(tilemap_t* pTiles, uint16_t uiFirst, uint16_t uiCount, const void* pDefs)
+{
+  if (pTiles && pDefs && (0 < uiCount))
+  {
+    const uint8_t uiShift = ((pTiles->uiFlags & ZXN_TILE_TEXT) ? 3 : 5);
+    const uint16_t uiLast = uiFirst + uiCount;
+    uint8_t uiMmu;
+
+    /* 256 tiles (512 with "ZXN_TILE_512"), all of them within bank 5 */
+    if ((uiLast < uiFirst) || (((pTiles->uiFlags & ZXN_TILE_512) ? 512 : 256) < uiLast) ||
+        ((uint16_t) ((uint16_t) pTiles->pTiles - TILE_BANK5) + (uiLast << uiShift) > TILE_BANK5_SIZE))
+    {
+      return EINVAL;
+    }
+
+    /* The slot may hold a page of Layer 2 (i.e. "zxn_l2_page") */
+    uiMmu = ZXN_READ_REG(REG_MMU0 + ZXN_PAGE_SLOT);
+    ZXN_WRITE_REG(REG_MMU0 + ZXN_PAGE_SLOT, TILE_BANK5_PAGE);
+    memcpy(pTiles->pTiles + (uiFirst << uiShift), pDefs, uiCount << uiShift);
+    ZXN_WRITE_REG(REG_MMU0 + ZXN_PAGE_SLOT, uiMmu);
+
+    return EOK;
+  }
+
+  return EINVAL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
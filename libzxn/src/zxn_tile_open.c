@@ -0,0 +1,121 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: zxn_tile_open.c                                                    |
+| project:  ZX Spectrum Next - libzxn                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Tilemap (Layer 3) with dirty-tile updates                                    |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stddef.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include "libzxn.h"
+#include "zxn_internal.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* zxn_tile_open()                                                            */
+/*----------------------------------------------------------------------------*/
+uint8_t zxn_tile_open(tilemap_t* pTiles, uint8_t uiMode, uint8_t uiFlags, void* pMap, void* pDefs)
+{
+  const uint16_t uiMap  = (uint16_t) pMap;
+  const uint16_t uiDefs = (uint16_t) pDefs;
+
+  if (pTiles &&
+      ((ZXN_TILE_40x32 == uiMode) || (ZXN_TILE_80x32 == uiMode)) &&
+      (TILE_BANK5 == (uiMap & TILE_BASE_MASK)) && (TILE_BANK5 == (uiDefs & TILE_BASE_MASK)))
+  {
+    pTiles->uiCols    = (ZXN_TILE_80x32 == uiMode ? 80 : 40);
+    pTiles->uiFlags   = uiFlags & (ZXN_TILE_NOATTR | ZXN_TILE_TEXT | ZXN_TILE_512 | ZXN_TILE_OVER_ULA);
+    pTiles->pMap      = (uint8_t*) pMap;
+    pTiles->pTiles    = (uint8_t*) pDefs;
+    pTiles->uiAttr    = 0x00;
+    pTiles->uiScrollX = 0;
+    pTiles->uiScrollY = 0;
+
+    pTiles->tPriv.uiCount = 0;
+    pTiles->tPriv.bScroll = 1;
+
+    ZXN_WRITE_REG(REG_TILE_MAP_BASE, (uint8_t) ((uiMap - TILE_BANK5) >> 8));
+    ZXN_WRITE_REG(REG_TILE_DEF_BASE, (uint8_t) ((uiDefs - TILE_BANK5) >> 8));
+    ZXN_WRITE_REG(REG_TILE_ATTR, pTiles->uiAttr);
+
+    /* The selection of the palette (BIT4) is kept */
+    ZXN_WRITE_REG(REG_TILE_CONTROL, (ZXN_READ_REG(REG_TILE_CONTROL) & 0x10) | TILE_ENABLE | uiMode | pTiles->uiFlags);
+
+    return EOK;
+  }
+
+  return EINVAL;
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/
@@ -0,0 +1,135 @@
+/*-----------------------------------------------------------------------------+
+|                                                                              |
+| filename: zxn_tile_update.c                                                  |
+| project:  ZX Spectrum Next - libzxn                                          |
+| author:   S. Zell                                                            |
+| date:     10/19/2026                                                         |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| description:                                                                 |
+|                                                                              |
+| Tilemap (Layer 3) with dirty-tile updates                                    |
+|                                                                              |
++------------------------------------------------------------------------------+
+|                                                                              |
+| Copyright (c) 10/19/2026 STZ Engineering                                     |
+|                                                                              |
+| This software is provided  "as is",  without warranty of any kind, express   |
+| or implied. In no event shall STZ or its contributors be held liable for any |
+| direct, indirect, incidental, special or consequential damages arising out   |
+| of the use of or inability to use this software.                             |
+|                                                                              |
+| Permission is granted to anyone  to use this  software for any purpose,      |
+| including commercial applications,  and to alter it and redistribute it      |
+| freely, subject to the following restrictions:                               |
+|                                                                              |
+| 1. Redistributions of source code must retain the above copyright            |
+|    notice, definition, disclaimer, and this list of conditions.              |
+|                                                                              |
+| 2. Redistributions in binary form must reproduce the above copyright         |
+|    notice, definition, disclaimer, and this list of conditions in            |
+|    documentation and/or other materials provided with the distribution.      |
+|                                                                          ;-) |
++-----------------------------------------------------------------------------*/
+
+/*============================================================================*/
+/*                               Includes                                     */
+/*============================================================================*/
+#include <stdint.h>
+#include <stddef.h>
+#include <errno.h>
+#include <arch/zxn.h>
+#include "libzxn.h"
+#include "zxn_internal.h"
+
+/*============================================================================*/
+/*                               Defines                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Namespaces                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Konstanten                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Variablen                                    */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Strukturen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Typ-Definitionen                             */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Prototypen                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Klassen                                      */
+/*============================================================================*/
+
+/*============================================================================*/
+/*                               Implementierung                              */
+/*============================================================================*/
+
+/*----------------------------------------------------------------------------*/
+/* zxn_tile_update()                                                          */
+/*----------------------------------------------------------------------------*/
+void zxn_tile_update(tilemap_t* pTiles) __z88dk_fastcall
+{
+  const tiledirty_t* pEntry;
+  uint8_t* pMap;
+  uint8_t uiMmu;
+  uint8_t i;
+
+  if (pTiles)
+  {
+    pEntry = pTiles->tPriv.acDirty;
+
+    /* The slot may hold a page of Layer 2 (i.e. "zxn_l2_page") */
+    uiMmu = ZXN_READ_REG(REG_MMU0 + ZXN_PAGE_SLOT);
+    ZXN_WRITE_REG(REG_MMU0 + ZXN_PAGE_SLOT, TILE_BANK5_PAGE);
+
+    if (pTiles->uiFlags & ZXN_TILE_NOATTR)
+    {
+      ZXN_WRITE_REG(REG_TILE_ATTR, pTiles->uiAttr);
+
+      for (i = pTiles->tPriv.uiCount; i; --i, ++pEntry)
+      {
+        pTiles->pMap[pEntry->uiIndex] = pEntry->uiTile;
+      }
+    }
+    else
+    {
+      for (i = pTiles->tPriv.uiCount; i; --i, ++pEntry)
+      {
+        pMap = pTiles->pMap + (pEntry->uiIndex << 1);
+        pMap[0] = pEntry->uiTile;
+        pMap[1] = pEntry->uiAttr;
+      }
+    }
+
+    ZXN_WRITE_REG(REG_MMU0 + ZXN_PAGE_SLOT, uiMmu);
+    pTiles->tPriv.uiCount = 0;
+
+    if (pTiles->tPriv.bScroll)
+    {
+      ZXN_WRITE_REG(REG_TILE_OFFSET_XH, (uint8_t) (pTiles->uiScrollX >> 8));
+      ZXN_WRITE_REG(REG_TILE_OFFSET_XL, (uint8_t) (pTiles->uiScrollX & 0xFF));
+      ZXN_WRITE_REG(REG_TILE_OFFSET_Y, pTiles->uiScrollY);
+      pTiles->tPriv.bScroll = 0;
+    }
+  }
+}
+
+
+/*----------------------------------------------------------------------------*/
+/*                                                                            */
+/*----------------------------------------------------------------------------*/